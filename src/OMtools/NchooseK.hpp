@@ -928,9 +928,7 @@ constexpr IndexType index_of(const std::array<LabelType, R>& a) {
 	l=0;
 	u=binomial_coefficient<IndexType>(N,R)-1;
 	m=(l+u)>>1;
-	// TODO: this line has to be rewritten once NchooseK also gets
-	// two integral type parameters
-	const auto& bases = NchooseK<LabelType, N, R>::array;
+	const auto& bases = NchooseK<LabelType, N, R, IndexType>::array;
 
 	for (i=0;i<R;i++)
 	{
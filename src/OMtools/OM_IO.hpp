@@ -3,6 +3,9 @@
 #include <iostream>
 #include <fstream>
 #include <string>
+#include <array>
+#include <vector>
+#include <cstdint>
 #include "OMs.hpp"
 
 // ============================
@@ -123,4 +126,66 @@ struct ReadOMDataFromFiles {
     ReadOMDataFromFiles end() const;
 };
 
+// ===========================
+// BinaryOMDatabaseWriter<R, N>
+// ===========================
+
+// A binary OM database stores chirotopes of rank `R` on `N` elements in
+// one file for each basecount, which is much faster to read and write
+// than the text databases. Each file starts with a header of 32-bit
+// unsigned integers (in the byte order of the machine): the magic number
+// `BINARY_OM_DATABASE_MAGIC`, `R`, `N`, the number of 32-bit integers
+// of a bitvector of length `binomial_coefficient(N, R)`, and the
+// basecount, followed by the number of chirotopes as a 64-bit unsigned
+// integer. Then each chirotope is stored as the integers of `plus`,
+// followed by the integers of `minus`.
+constexpr uint32_t BINARY_OM_DATABASE_MAGIC = 0x42444d4f; // "OMDB"
+
+// Writes a binary OM database. The file of a given basecount is created
+// when the first chirotope with that basecount is written, and the
+// headers are completed by `close()`, or on destruction. Basecounts to
+// which nothing was written get no file. Not safe to use from several
+// threads at once. Failed writes throw `std::invalid_argument`, except
+// on destruction, where they are only reported to `std::cerr`.
+//
+// The paths are given by a function pointer `std::string (*)(int n_bases)`,
+// such as `database_names::binary_OM_set<R, N>`.
+template<int R, int N>
+class BinaryOMDatabaseWriter {
+public:
+    // The number of `R`-tuples, i.e. the largest possible basecount.
+    constexpr static const int NR = binomial_coefficient(N, R);
+
+    BinaryOMDatabaseWriter(std::string (*path_of)(int));
+    BinaryOMDatabaseWriter(const BinaryOMDatabaseWriter&) = delete;
+    ~BinaryOMDatabaseWriter();
+
+    // Appends the given chirotope to the file of its basecount.
+    void write(const Chirotope<R, N>&);
+    // Completes the headers, and closes all files.
+    void close();
+    // Returns the number of chirotopes written with the given basecount.
+    uint64_t count(int n_bases) const
+    { return counts[n_bases]; }
+
+private:
+    std::string (*path_of)(int);
+    std::array<std::ofstream, NR + 1> files;
+    std::array<uint64_t, NR + 1> counts;
+};
+
+// Reads all chirotopes from the file of a binary OM database with the
+// given path. Returns an empty list if the file does not exist, and
+// throws `std::invalid_argument` if its header does not match `R, N`,
+// or if the number of chirotopes in its header does not match the size
+// of the file (e.g. because its writer was never closed).
+template<int R, int N>
+ChirotopeArray<R, N> read_binary_OM_file(const std::string& path);
+
+// Reads a binary OM database, whose paths are given as in
+// `BinaryOMDatabaseWriter`. The result is grouped by basecount, where
+// the index is shifted by 1 from the actual basecount.
+template<int R, int N>
+std::vector<ChirotopeArray<R, N>> read_binary_OM_database(std::string (*path_of)(int));
+
 #include "OM_IO_impl.hpp"
\ No newline at end of file
@@ -279,3 +279,113 @@ ReadOMDataFromFiles<StreamReadable> ReadOMDataFromFiles<StreamReadable>::end() c
         true
     );
 }
+
+// ======================
+// BinaryOMDatabaseWriter
+// ======================
+
+template<int R, int N>
+BinaryOMDatabaseWriter<R, N>::BinaryOMDatabaseWriter(std::string (*path_of)(int)):
+path_of(path_of) {
+    counts.fill(0);
+}
+
+template<int R, int N>
+BinaryOMDatabaseWriter<R, N>::~BinaryOMDatabaseWriter() {
+    try {
+        close();
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+    }
+}
+
+template<int R, int N>
+void BinaryOMDatabaseWriter<R, N>::write(const Chirotope<R, N>& chi) {
+    int n_bases = chi.countbases();
+    auto& file = files[n_bases];
+    if (!file.is_open()) {
+        file.open(path_of(n_bases), std::ios::binary | std::ios::trunc);
+        if (!file) throw std::invalid_argument(std::format(
+            "Could not create the file {0}.", path_of(n_bases)
+        ));
+        uint32_t header[5] = {
+            BINARY_OM_DATABASE_MAGIC, R, N, Chirotope<R, N>::NR_INT32, (uint32_t)n_bases
+        };
+        uint64_t count = 0;
+        file.write((const char*)header, sizeof(header));
+        file.write((const char*)&count, sizeof(count));
+    }
+    file.write((const char*)chi.plus.bits, sizeof(chi.plus.bits));
+    file.write((const char*)chi.minus.bits, sizeof(chi.minus.bits));
+    if (file.fail()) throw std::invalid_argument(std::format(
+        "Could not write to the file {0}.", path_of(n_bases)
+    ));
+    ++counts[n_bases];
+}
+
+template<int R, int N>
+void BinaryOMDatabaseWriter<R, N>::close() {
+    // Every file is closed, even if an earlier one failed.
+    int failed = -1;
+    for (int n_bases = 0; n_bases <= NR; ++n_bases) {
+        auto& file = files[n_bases];
+        if (!file.is_open()) continue;
+        file.seekp(5 * sizeof(uint32_t));
+        file.write((const char*)&counts[n_bases], sizeof(uint64_t));
+        file.close();
+        if (file.fail()) failed = n_bases;
+    }
+    if (failed != -1) throw std::invalid_argument(std::format(
+        "Could not complete the file {0}.", path_of(failed)
+    ));
+}
+
+template<int R, int N>
+ChirotopeArray<R, N> read_binary_OM_file(const std::string& path) {
+    ChirotopeArray<R, N> chirotopes;
+    std::ifstream file(path, std::ios::binary);
+    if (!file) return chirotopes;
+    uint32_t header[5];
+    uint64_t count;
+    file.read((char*)header, sizeof(header));
+    file.read((char*)&count, sizeof(count));
+    if (!file || header[0] != BINARY_OM_DATABASE_MAGIC || header[1] != R || header[2] != N
+        || header[3] != Chirotope<R, N>::NR_INT32) {
+        throw std::invalid_argument(std::format(
+            "The file {0} is not a binary database of rank {1} oriented matroids on {2} elements.",
+            path, R, N
+        ));
+    }
+    // The count is only written when the database is closed, so a file
+    // of a crashed writer may claim fewer (or more) chirotopes than it
+    // holds, which is caught by comparing with the size of the file.
+    constexpr uint64_t RECORD_SIZE = 2 * Chirotope<R, N>::NR_INT32 * sizeof(uint32_t);
+    const uint64_t data_start = file.tellg();
+    file.seekg(0, std::ios::end);
+    const uint64_t data_size = (uint64_t)file.tellg() - data_start;
+    file.seekg(data_start);
+    if (!file || data_size != count * RECORD_SIZE) {
+        throw std::invalid_argument(std::format(
+            "The file {0} holds {1} bytes of chirotopes, but its header claims {2} chirotopes of {3} bytes each.",
+            path, data_size, count, RECORD_SIZE
+        ));
+    }
+    chirotopes.resize(count);
+    for (auto& chi: chirotopes) {
+        file.read((char*)chi.plus.bits, sizeof(chi.plus.bits));
+        file.read((char*)chi.minus.bits, sizeof(chi.minus.bits));
+    }
+    if (!file) throw std::invalid_argument(std::format(
+        "The file {0} ends before its {1} chirotopes.", path, count
+    ));
+    return chirotopes;
+}
+
+template<int R, int N>
+std::vector<ChirotopeArray<R, N>> read_binary_OM_database(std::string (*path_of)(int)) {
+    std::vector<ChirotopeArray<R, N>> by_basecount(binomial_coefficient(N, R));
+    for (int n_bases = 1; n_bases <= binomial_coefficient(N, R); ++n_bases) {
+        by_basecount[n_bases - 1] = read_binary_OM_file<R, N>(path_of(n_bases));
+    }
+    return by_basecount;
+}
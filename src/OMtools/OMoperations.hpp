@@ -114,6 +114,13 @@ template<int R, int N, typename Iterable>
 constexpr svo::Multiply<Chirotope<R, N>> 
 reorient_elements(const Iterable&);
 
+// Constructs the same chirotope-operator as `reorient_elements`,
+// with the set of elements given as a bitmask: the element `e` is
+// reoriented if the `e`th least significant bit is 1.
+template<int R, int N>
+constexpr svo::Multiply<Chirotope<R, N>> 
+reorient_elements_in_mask(uint32_t);
+
 // ==========
 // RELABELING
 // ==========
@@ -399,13 +406,83 @@ constexpr auto cocircuit_extractors_from_chirotope{[]() constexpr {
     return cocircuit_constructors;
 }()};
 
+// The table from which `cocircuits` gathers all cocircuits of a
+// chirotope at once, holding the same data as
+// `cocircuit_extractors_from_chirotope`: `bases[i][e]` is the index
+// of the `R`-tuple formed by the `i`th `R-1`-subset of `0..N-1` and
+// the element `e` (or `-1` if `e` is in the subset), and bit `e` of
+// `reoriented[i]` is set if an odd number of elements of the subset
+// precede `e`, so that the sign at that index has to be flipped.
+template<int R, int N>
+struct CocircuitGatherMap {
+    static_assert(N <= 32, "Sets of elements are stored as 32-bit masks.");
+    using R1TUPLES = Rtuples::RTUPLES<char,R-1,N,int>; // (R-1)-tuples
+    std::array<std::array<int, N>, R1TUPLES::NR> bases;
+    std::array<uint32_t, R1TUPLES::NR> reoriented;
+};
+
+template<int R, int N>
+constexpr CocircuitGatherMap<R, N> cocircuit_gather_map{[]() constexpr {
+    using RTUPLES = Chirotope<R, N>::RTUPLES; // R-tuples
+    using R1TUPLES = CocircuitGatherMap<R, N>::R1TUPLES;
+    CocircuitGatherMap<R, N> map{};
+    for (int cocirc_idx = 0; cocirc_idx < R1TUPLES::NR; ++cocirc_idx) {
+        std::array<char, R-1> R1tuple = R1TUPLES::LIST::array[cocirc_idx];
+        for (int element = 0; element < N; ++element) {
+            std::array<char, R> full_Rtuple{};
+            char t = 0;
+            while (t < R-1 && R1tuple[t] < element) {
+                full_Rtuple[t] = R1tuple[t];
+                ++t;
+            }
+            map.reoriented[cocirc_idx] |= uint32_t(t % 2) << element;
+            if (t < R-1 && R1tuple[t] == element) {
+                map.bases[cocirc_idx][element] = -1;
+                continue;
+            }
+            full_Rtuple[t] = element;
+            for (++t; t < R; ++t) {
+                full_Rtuple[t] = R1tuple[t - 1];
+            }
+            map.bases[cocirc_idx][element] = RTUPLES::index_of_ordered(full_Rtuple);
+        }
+    }
+    return map;
+}()};
+
 // Computes the list of cocircuits of a chirotope.
 // From each pair of cocircuits `C`, `-C` only one is
 // included in the list. Those included are in lexicographically
 // sorted by the sets on which vanish.
+//
+// All `R-1`-subsets are gathered in one pass using
+// `cocircuit_gather_map`. The cocircuit vanishing on an independent
+// subset is kept if no earlier subset gave the same zero set: the
+// earliest one is the lexicographically first basis of the zero set.
+// For `N > 32`, where the zero sets do not fit into 32-bit masks,
+// `cocircuits_by_extractors` is used instead.
 template<int R, int N>
 constexpr std::vector<sign_vector<N>> cocircuits(const Chirotope<R, N>&);
 
+// Computes the same list as `cocircuits`, in the same order and with
+// the same signs, for any `N`: the candidates are extracted one by one
+// with `cocircuit_extractors_from_chirotope`, and each is kept if its
+// `R-1`-subset is the first basis of its zero set, as found by
+// `maximal_independent_subset_of_rank`.
+template<int R, int N>
+constexpr std::vector<sign_vector<N>> cocircuits_by_extractors(const Chirotope<R, N>&);
+
+// Computes the cocircuits of the deletion of a set of elements (bit `e`
+// of `deleted` standing for element `e`, see `delete_elements`) from a
+// chirotope, given the list of cocircuits of the chirotope: these are
+// the minimal nonzero restrictions of the given cocircuits to the other
+// elements. If one of the cocircuits vanishes on all other elements,
+// then the deletion has lower rank, its chirotope is zero, and the
+// result is empty. Agrees with `cocircuits` up to order and signs, but
+// only takes `O(K^2)` time for `K` cocircuits.
+template<int N>
+std::vector<sign_vector<N>> cocircuits_of_deletion(const std::vector<sign_vector<N>>&, uint32_t deleted);
+
 // =============
 // MISCELLANEOUS
 // =============
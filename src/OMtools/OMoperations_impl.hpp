@@ -1,6 +1,7 @@
 #pragma once
 
 #include <algorithm>
+#include <bit>
 #include "OMoperations.hpp"
 
 namespace OM_operations {
@@ -115,6 +116,19 @@ constexpr svo::Multiply<Chirotope<R, N>> reorient_elements(const Iterable& eleme
     return {to_reorient};
 }
 
+template<int R, int N>
+constexpr svo::Multiply<Chirotope<R, N>> reorient_elements_in_mask(uint32_t elements) {
+    using RTUPLES = Chirotope<R, N>::RTUPLES;
+    bit_vector<RTUPLES::NR> to_reorient{};
+    for (; elements; elements &= elements - 1) {
+        int element = std::countr_zero(elements);
+        for (auto i = 0; i < bit_vector<RTUPLES::NR>::NR_INT32; ++i) {
+            to_reorient[i] ^= RTUPLES::LIST::contained_mask32[element][i];
+        }
+    }
+    return {to_reorient};
+}
+
 // ==========
 // RELABELING
 // ==========
@@ -330,15 +344,46 @@ contract_labels(const Iterable& labels) {
 
 template<int R, int N>
 constexpr std::vector<sign_vector<N>> cocircuits(const Chirotope<R, N>& chi) {
-    using R1TUPLES = Rtuples::RTUPLES<char,R-1,N,int>; // (R-1)-tuples
-    constexpr auto N_NR_INT32 = division_rounded_up(N, 32);
-    std::vector<sign_vector<N>> cocircuits_so_far{};
-    auto candidate = cocircuit_extractors_from_chirotope<R,N>[0] * chi;
-    if (!candidate.is_zero()) {
-        cocircuits_so_far.push_back(candidate);
+    if constexpr (N > 32) {
+        return cocircuits_by_extractors(chi);
+    } else {
+        std::vector<sign_vector<N>> cocircuits_so_far{};
+        using R1TUPLES = CocircuitGatherMap<R, N>::R1TUPLES;
+        constexpr auto& map = cocircuit_gather_map<R, N>;
+        // The zero sets of `cocircuits_so_far`.
+        std::vector<uint32_t> zero_sets{};
+        for (int idx = 0; idx < R1TUPLES::NR; ++idx) {
+            uint32_t plus = 0;
+            uint32_t minus = 0;
+            for (int element = 0; element < N; ++element) {
+                int basis = map.bases[idx][element];
+                if (basis < 0) continue;
+                plus |= ((chi.plus[basis / 32] >> (basis % 32)) & 1) << element;
+                minus |= ((chi.minus[basis / 32] >> (basis % 32)) & 1) << element;
+            }
+            if ((plus | minus) == 0) continue; // the subset is dependent
+            uint32_t zero_set = ~(plus | minus);
+            if (std::find(zero_sets.begin(), zero_sets.end(), zero_set) != zero_sets.end()) {
+                continue;
+            }
+            zero_sets.push_back(zero_set);
+            const uint32_t reoriented = map.reoriented[idx];
+            sign_vector<N> cocircuit{};
+            cocircuit.plus[0] = (plus & ~reoriented) | (minus & reoriented);
+            cocircuit.minus[0] = (minus & ~reoriented) | (plus & reoriented);
+            cocircuits_so_far.push_back(cocircuit);
+        }
+        return cocircuits_so_far;
     }
-    for (int idx = 1; idx < R1TUPLES::NR; ++idx) {
+}
+
+template<int R, int N>
+constexpr std::vector<sign_vector<N>> cocircuits_by_extractors(const Chirotope<R, N>& chi) {
+    std::vector<sign_vector<N>> cocircuits_so_far{};
+    using R1TUPLES = Rtuples::RTUPLES<char,R-1,N,int>; // (R-1)-tuples
+    for (int idx = 0; idx < R1TUPLES::NR; ++idx) {
         auto candidate = cocircuit_extractors_from_chirotope<R,N>[idx] * chi;
+        if (candidate.is_zero()) continue;
         if (R1TUPLES::LIST::array[idx] ==
         chi.template maximal_independent_subset_of_rank<R-1>(candidate.indices_of_zeros())) {
             cocircuits_so_far.push_back(candidate);
@@ -347,4 +392,33 @@ constexpr std::vector<sign_vector<N>> cocircuits(const Chirotope<R, N>& chi) {
     return cocircuits_so_far;
 }
 
+template<int N>
+std::vector<sign_vector<N>> cocircuits_of_deletion(
+    const std::vector<sign_vector<N>>& cocircuits, 
+    uint32_t deleted
+) {
+    static_assert(N <= 32, "Sets of elements are stored as 32-bit masks.");
+    std::vector<sign_vector<N>> restrictions;
+    std::vector<uint32_t> supports;
+    for (sign_vector<N> cocircuit: cocircuits) {
+        cocircuit.plus[0] &= ~deleted;
+        cocircuit.minus[0] &= ~deleted;
+        if (cocircuit.is_zero()) return {};
+        restrictions.push_back(cocircuit);
+        supports.push_back(cocircuit.plus[0] | cocircuit.minus[0]);
+    }
+    // Restrictions with the same support are equal up to sign, so only
+    // the first one of them is kept.
+    std::vector<sign_vector<N>> cocircuits_so_far{};
+    for (size_t i = 0; i < restrictions.size(); ++i) {
+        bool is_minimal = true;
+        for (size_t j = 0; j < restrictions.size() && is_minimal; ++j) {
+            is_minimal = (supports[j] & ~supports[i]) != 0 
+                || (supports[j] == supports[i] && j >= i);
+        }
+        if (is_minimal) cocircuits_so_far.push_back(restrictions[i]);
+    }
+    return cocircuits_so_far;
+}
+
 }
\ No newline at end of file
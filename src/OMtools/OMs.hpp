@@ -401,6 +401,17 @@ struct Chirotope: public sign_vector<binomial_coefficient(N, R)> {
     friend std::ifstream& operator>> <>(std::ifstream&, Chirotope&);
 };
 
+// A list of chirotopes of rank `R` on `N` elements, as processed by
+// the batched operations.
+template<int R, int N>
+using ChirotopeArray = std::vector<Chirotope<R, N>>;
+
+// Matroids and chirotopes are hashed as their bitvectors and signvectors.
+template<int R, int N>
+struct std::hash<Matroid<R, N>>: std::hash<bit_vector<binomial_coefficient(N, R)>> {};
+template<int R, int N>
+struct std::hash<Chirotope<R, N>>: std::hash<sign_vector<binomial_coefficient(N, R)>> {};
+
 // This file declares templates, so their implementations must
 // be in this same header file as well.
 #include "OMs_impl.hpp"
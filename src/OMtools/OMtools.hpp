@@ -6,7 +6,19 @@
 #include "signvectoroperations.hpp"
 #include "OMs.hpp"
 #include "OMoperations.hpp"
+#include "covectors.hpp"
 #include "OMexamples.hpp"
 #include "OM_IO.hpp"
 #include "databasenames.hpp"
 #include "ordercomplexes.hpp"
+#include "parallel.hpp"
+#include "posets.hpp"
+#include "signassignments.hpp"
+#include "canonicalforms.hpp"
+#include "relabelingkernels.hpp"
+#include "orbits.hpp"
+#include "permutationgroups.hpp"
+#include "fixedpoints.hpp"
+#include "extensions.hpp"
+#include "orbitposets.hpp"
+#include "equivariant.hpp"
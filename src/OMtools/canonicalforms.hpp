@@ -0,0 +1,172 @@
+#pragma once
+
+#include <cstdint>
+#include <array>
+#include <utility>
+#include <vector>
+#include "OMs.hpp"
+#include "OMoperations.hpp"
+#include "signassignments.hpp"
+#include "permutationgroups.hpp"
+
+namespace OM_operations {
+
+// ========================
+// CANONICAL REORIENTATIONS
+// ========================
+
+// The lexicographically first set of bases of a matroid whose
+// characteristic vectors are linearly independent over `GF(2)` and
+// span those of all bases. Every basis is a sum of these, so the signs
+// of these bases determine the reorientation class of a chirotope with
+// this underlying matroid, and making them positive brings every
+// chirotope of the class to the same canonical reorientation.
+template<int R, int N>
+struct SpanningBases {
+    static_assert(N <= 32, "Sets of elements are stored as 32-bit masks.");
+    // The number of chosen bases.
+    int size;
+    // The indices of the chosen bases in `RTUPLES::LIST::array`.
+    std::array<int, N> bases;
+    // `flips[j]` is the set of elements (bit `e` standing for element
+    // `e`) whose reorientation changes the sign of `bases[j]` and of no
+    // other chosen basis.
+    std::array<uint32_t, N> flips;
+
+    // Chooses the bases by Gaussian elimination over `GF(2)`.
+    SpanningBases(const Matroid<R, N>&);
+
+    // Returns the set of elements (as in `flips`) whose reorientation
+    // makes all chosen bases positive in `chi`, which must have the
+    // underlying matroid given in the constructor. Takes `O(N)` time.
+    uint32_t reoriented_elements(const Chirotope<R, N>& chi) const;
+};
+
+// Returns the canonical reorientation of `chi` (see `SpanningBases`):
+// two chirotopes have the same canonical reorientation if and only if
+// one of them is a reorientation of the other. If `reoriented` is not
+// `nullptr`, the set of elements reoriented to get it is written to it.
+template<int R, int N>
+Chirotope<R, N> canonical_reorientation(const Chirotope<R, N>& chi, uint32_t* reoriented = nullptr);
+
+// Replaces every chirotope of `chis` by its canonical reorientation,
+// and returns the sets of elements reoriented (as in `SpanningBases`).
+// The spanning bases are only computed once for each underlying
+// matroid, after which each chirotope takes `O(N * words)` time.
+template<int R, int N>
+std::vector<uint32_t> canonicalize_reorientations(ChirotopeArray<R, N>& chis);
+
+// ===============
+// CANONICAL FORMS
+// ===============
+
+// Describes a canonical representative of the isomorphism class of an
+// oriented matroid, together with a transformation which produces it.
+//
+// If `chi` is the input of `canonical_form`, then `chirotope` is
+// obtained by first reorienting `reoriented_elements` in `chi`, then
+// relabeling the result by `relabeling` (see `relabel_elements`), and
+// finally inverting it if `inverted` is `true`.
+template<int R, int N>
+struct CanonicalForm {
+    // The canonical representative.
+    Chirotope<R, N> chirotope;
+    // `relabeling[i]` is the new label of the element `i` of the input.
+    std::array<int, N> relabeling;
+    // The elements of the input (with their original labels) which are
+    // reoriented before relabeling.
+    std::vector<int> reoriented_elements;
+    // Whether the relabeled chirotope is inverted at the end.
+    bool inverted;
+};
+
+// A total order on chirotopes, used to choose canonical representatives:
+// the words of `plus` are compared first, and then those of `minus`.
+template<int R, int N>
+constexpr bool canonically_less(const Chirotope<R, N>&, const Chirotope<R, N>&);
+
+// Computes a canonical representative of the oriented matroid defined
+// by `chi` up to relabeling and reorientation of the elements: two
+// chirotopes have the same canonical representative if and only if
+// one of them can be transformed into the other one or its inverse by
+// relabeling and reorienting. The representative and a transformation
+// producing it are returned.
+//
+// The elements are first colored by invariants which do not change
+// under reorientation: the number of bases containing each element or
+// pair of elements, and how pairs of elements sit in the three-term
+// Grassmann-Plucker relations (which of the three terms vanish, or has
+// the sign different from the other two). The colors are refined
+// until they are stable, and only relabelings respecting the colors
+// are tried, individualizing elements when the colors do not determine
+// the labels. For each such relabeling, the reorientation is fixed by
+// `canonical_reorientation`, and the smallest result (with respect to
+// `canonically_less`) is kept.
+template<int R, int N>
+CanonicalForm<R, N> canonical_form(const Chirotope<R, N>& chi);
+
+// =============
+// AUTOMORPHISMS
+// =============
+
+// Returns the group of permutations `p` of the elements such that the
+// relabeling of `chi` by `p` (see `relabel_elements`) defines the same
+// oriented matroid as `chi`, i.e. it is `chi` or its inverse. If
+// `include_reorientations` is `true`, then `p` may also be followed by
+// a reorientation: the group of the reorientation class is returned.
+//
+// The same individualization-refinement search is used as in
+// `canonical_form`. The leaves whose relabeled chirotopes agree (up to
+// inversion, and reorientation if included) with the first one give
+// automorphisms, which generate the group together with the
+// transpositions of the twins skipped by the search.
+template<int R, int N>
+PermutationGroup<N> automorphism_group(const Chirotope<R, N>& chi, bool include_reorientations = false);
+
+// =========
+// INTERNALS
+// =========
+
+// Invariants of pairs of elements `e != f` (and of single elements if
+// `e == f`), which do not change under reorientation and inversion.
+template<int N>
+using _PairInvariants = std::array<std::array<std::array<uint32_t, 5>, N>, N>;
+
+// Computes the invariants used by `canonical_form` to color elements.
+template<int R, int N>
+_PairInvariants<N> _pair_invariants(const Chirotope<R, N>& chi);
+
+// Refines the given coloring of the elements using the pair invariants,
+// until the number of colors stops growing. The colors are replaced by
+// `0..k-1`, ordered in a way which only depends on the invariants.
+template<int N>
+void _refine_colors(std::array<int, N>& colors, const _PairInvariants<N>& invariants);
+
+// Returns whether `e != f` are twins, i.e. two loops or two parallel
+// elements, which can be swapped by an automorphism up to reorientation.
+// Twins are read off `invariants`: a pair of elements is dependent if
+// and only if no basis contains it.
+template<int N>
+bool _are_twins(const _PairInvariants<N>& invariants, int e, int f);
+
+// Calls `leaf(labels)` for every relabeling `labels` (element `e` gets
+// label `labels[e]`) produced by the individualization-refinement search
+// starting from the given coloring. The set of chirotopes obtained by
+// applying these relabelings, up to reorientation, only depends on the
+// isomorphism class of the chirotope.
+//
+// Elements `e, f` for which `are_twins(e, f)` holds must be swapped by
+// an automorphism, so only one of them is individualized in each cell.
+template<int N, typename AreTwins, typename Leaf>
+void _for_each_refined_relabeling(
+    std::array<int, N> colors,
+    const _PairInvariants<N>& invariants,
+    AreTwins&& are_twins,
+    Leaf&& leaf
+);
+
+}
+
+// This file declares templates, so their implementations must
+// be in this same header file as well.
+#include "canonicalforms_impl.hpp"
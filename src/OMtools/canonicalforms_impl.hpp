@@ -0,0 +1,338 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <map>
+#include <numeric>
+#include "canonicalforms.hpp"
+
+namespace OM_operations {
+
+// ========================
+// CANONICAL REORIENTATIONS
+// ========================
+
+template<int R, int N>
+SpanningBases<R, N>::SpanningBases(const Matroid<R, N>& matroid): size(0) {
+    using RTUPLES = Matroid<R, N>::RTUPLES;
+    // An echelon form of the characteristic vectors of the chosen bases:
+    // each row is reduced by the rows before it, `pivots[r]` is its
+    // lowest element, and `combinations[r]` is the set of chosen bases
+    // (bit `j` standing for `bases[j]`) it is the sum of.
+    std::array<uint32_t, N> rows;
+    std::array<int, N> pivots;
+    std::array<uint32_t, N> combinations;
+    for (int b = 0; b < RTUPLES::NR && size < N; ++b) {
+        if (!matroid.is_basis(b)) continue;
+        uint32_t row = 0;
+        for (int k = 0; k < R; ++k) row |= 1u << RTUPLES::LIST::array[b][k];
+        uint32_t combination = 1u << size;
+        for (int r = 0; r < size; ++r) {
+            if (row >> pivots[r] & 1) {
+                row ^= rows[r];
+                combination ^= combinations[r];
+            }
+        }
+        if (row == 0) continue;
+        bases[size] = b;
+        rows[size] = row;
+        pivots[size] = std::countr_zero(row);
+        combinations[size] = combination;
+        ++size;
+    }
+    // Only pivots are reoriented. Row `r` only contains pivots of later
+    // rows, so going backwards, `depends_on[r]` is the set of chosen
+    // bases whose negativity toggles the reorientation of `pivots[r]`.
+    std::array<uint32_t, N> depends_on;
+    for (int r = size - 1; r >= 0; --r) {
+        depends_on[r] = combinations[r];
+        for (int q = r + 1; q < size; ++q) {
+            if (rows[r] >> pivots[q] & 1) depends_on[r] ^= depends_on[q];
+        }
+    }
+    for (int j = 0; j < size; ++j) {
+        flips[j] = 0;
+        for (int r = 0; r < size; ++r) {
+            if (depends_on[r] >> j & 1) flips[j] |= 1u << pivots[r];
+        }
+    }
+}
+
+template<int R, int N>
+uint32_t SpanningBases<R, N>::reoriented_elements(const Chirotope<R, N>& chi) const {
+    uint32_t reoriented = 0;
+    for (int j = 0; j < size; ++j) {
+        if (chi.get_minus(bases[j])) reoriented ^= flips[j];
+    }
+    return reoriented;
+}
+
+template<int R, int N>
+Chirotope<R, N> canonical_reorientation(const Chirotope<R, N>& chi, uint32_t* reoriented) {
+    uint32_t elements = SpanningBases<R, N>(chi.underlying_matroid()).reoriented_elements(chi);
+    if (reoriented != nullptr) *reoriented = elements;
+    return reorient_elements_in_mask<R, N>(elements)(chi);
+}
+
+template<int R, int N>
+std::vector<uint32_t> canonicalize_reorientations(ChirotopeArray<R, N>& chis) {
+    auto words_less = [](const Matroid<R, N>& M1, const Matroid<R, N>& M2) {
+        for (int i = 0; i < Matroid<R, N>::NR_INT32; ++i) {
+            if (M1[i] != M2[i]) return M1[i] < M2[i];
+        }
+        return false;
+    };
+    std::map<Matroid<R, N>, SpanningBases<R, N>, decltype(words_less)> spanning_bases(words_less);
+    std::vector<uint32_t> reoriented(chis.size());
+    for (size_t idx = 0; idx < chis.size(); ++idx) {
+        auto matroid = chis[idx].underlying_matroid();
+        auto it = spanning_bases.find(matroid);
+        if (it == spanning_bases.end()) it = spanning_bases.emplace(matroid, SpanningBases<R, N>(matroid)).first;
+        reoriented[idx] = it->second.reoriented_elements(chis[idx]);
+        chis[idx] = reorient_elements_in_mask<R, N>(reoriented[idx])(chis[idx]);
+    }
+    return reoriented;
+}
+
+// ===============
+// CANONICAL FORMS
+// ===============
+
+template<int R, int N>
+constexpr bool canonically_less(const Chirotope<R, N>& chi1, const Chirotope<R, N>& chi2) {
+    for (int i = 0; i < Chirotope<R, N>::NR_INT32; ++i) {
+        if (chi1.plus[i] != chi2.plus[i]) return chi1.plus[i] < chi2.plus[i];
+    }
+    for (int i = 0; i < Chirotope<R, N>::NR_INT32; ++i) {
+        if (chi1.minus[i] != chi2.minus[i]) return chi1.minus[i] < chi2.minus[i];
+    }
+    return false;
+}
+
+template<int R, int N>
+CanonicalForm<R, N> canonical_form(const Chirotope<R, N>& chi) {
+    CanonicalForm<R, N> result{};
+    bool found = false;
+    // The reorientation of the best candidate, with the new labels.
+    uint32_t best_reoriented = 0;
+    auto invariants = _pair_invariants(chi);
+    auto are_twins = [&invariants](int e, int f) { return _are_twins<N>(invariants, e, f); };
+    _for_each_refined_relabeling<N>(std::array<int, N>{}, invariants, are_twins,
+    [&](const std::array<int, N>& labels) {
+        auto relabeled = relabel_elements<R, N>(labels)(chi);
+        for (bool inverted: {false, true}) {
+            uint32_t reoriented;
+            auto candidate = canonical_reorientation(
+                inverted ? relabeled.inverse() : relabeled, &reoriented
+            );
+            if (!found || canonically_less(candidate, result.chirotope)) {
+                found = true;
+                result.chirotope = candidate;
+                result.relabeling = labels;
+                result.inverted = inverted;
+                best_reoriented = reoriented;
+            }
+        }
+    });
+    for (int e = 0; e < N; ++e) {
+        if (best_reoriented >> result.relabeling[e] & 1) result.reoriented_elements.push_back(e);
+    }
+    return result;
+}
+
+// =============
+// AUTOMORPHISMS
+// =============
+
+template<int R, int N>
+PermutationGroup<N> automorphism_group(const Chirotope<R, N>& chi, bool include_reorientations) {
+    auto invariants = _pair_invariants(chi);
+    // Loops and parallel elements can always be swapped, but antiparallel
+    // elements only together with a reorientation.
+    auto are_twins = [&](int e, int f) {
+        if (!_are_twins<N>(invariants, e, f)) return false;
+        if (include_reorientations || invariants[e][e][0] == 0) return true;
+        auto swapped = relabel_elements<R, N>(cycle_permutation<N>({e, f}))(chi);
+        return swapped == chi || swapped == chi.inverse();
+    };
+    std::vector<Permutation<N>> generators;
+    for (int e = 0; e < N; ++e) {
+        for (int f = e + 1; f < N; ++f) {
+            if (are_twins(e, f)) generators.push_back(cycle_permutation<N>({e, f}));
+        }
+    }
+    // The chirotope of a leaf, chosen from those defining the same
+    // oriented matroid (or reorientation class).
+    auto certificate = [&](const Chirotope<R, N>& relabeled) {
+        auto candidate = include_reorientations ? canonical_reorientation(relabeled) : relabeled;
+        auto inverse = include_reorientations ? canonical_reorientation(relabeled.inverse()) : relabeled.inverse();
+        return canonically_less(inverse, candidate) ? inverse : candidate;
+    };
+    bool found = false;
+    Chirotope<R, N> first;
+    Permutation<N> from_first;
+    _for_each_refined_relabeling<N>(std::array<int, N>{}, invariants, are_twins,
+    [&](const std::array<int, N>& labels) {
+        auto candidate = certificate(relabel_elements<R, N>(labels)(chi));
+        if (!found) {
+            found = true;
+            first = candidate;
+            from_first = inverse_permutation<N>(labels);
+        } else if (candidate == first) {
+            generators.push_back(compose_permutations<N>(from_first, labels));
+        }
+    });
+    return PermutationGroup<N>(generators);
+}
+
+// =========
+// INTERNALS
+// =========
+
+template<int R, int N>
+_PairInvariants<N> _pair_invariants(const Chirotope<R, N>& chi) {
+    using RTUPLES = Chirotope<R, N>::RTUPLES;
+    // The fields of the invariants of a pair `e, f`:
+    //   `0`: the number of bases containing both (or `e` if `e == f`),
+    //   `1 + c`: the number of terms of class `c` of three-term
+    //       Grassmann-Plucker relations in which `{e, f}` is the pair of
+    //       elements added to `X` in one of the two factors, where the
+    //       class is `0` for vanishing terms, `1` for the only term with
+    //       its sign, `2` for the other terms if all terms are nonzero,
+    //       and `3` for nonzero terms if only two terms are nonzero.
+    _PairInvariants<N> invariants{};
+    std::array<uint32_t, RTUPLES::NR> masks;
+    std::array<int, RTUPLES::NR> values;
+    for (int b = 0; b < RTUPLES::NR; ++b) {
+        masks[b] = 0;
+        for (int k = 0; k < R; ++k) masks[b] |= 1u << RTUPLES::LIST::array[b][k];
+        values[b] = chi.get_plus(b) ? 1 : (chi.get_minus(b) ? -1 : 0);
+        if (values[b] == 0) continue;
+        for (int k = 0; k < R; ++k) {
+            for (int l = 0; l < R; ++l) {
+                ++invariants[RTUPLES::LIST::array[b][k]][RTUPLES::LIST::array[b][l]][0];
+            }
+        }
+    }
+    // Only the entries with `e < f` are counted below, and then copied.
+    auto add_to_pair = [&invariants](uint32_t pair, int field) {
+        ++invariants[std::countr_zero(pair)][std::countr_zero(pair & (pair - 1))][field];
+    };
+    // `term_classes[p][t]` is the class of the `t`th term if the terms
+    // have the pattern `p`, where `0`, `+`, `-` are encoded as base 3
+    // digits `0`, `1`, `2`, starting with the first term.
+    constexpr static auto term_classes = []() {
+        std::array<std::array<int, 3>, 27> classes{};
+        for (int p = 0; p < 27; ++p) {
+            std::array<int, 3> terms{p % 3, p / 3 % 3, p / 9};
+            int nr_zero = 0, nr_positive = 0;
+            for (int t = 0; t < 3; ++t) {
+                nr_zero += terms[t] == 0;
+                nr_positive += terms[t] == 1;
+            }
+            for (int t = 0; t < 3; ++t) {
+                if (terms[t] == 0) classes[p][t] = 0;
+                else if (nr_zero > 0) classes[p][t] = 3;
+                else if ((terms[t] == 1) == (nr_positive == 1)) classes[p][t] = 1;
+                else classes[p][t] = 2;
+            }
+        }
+        return classes;
+    }();
+    for (const auto& relation: three_term_GP_relations<R, N>()) {
+        int pattern = 0;
+        for (int t = 2; t >= 0; --t) {
+            int term = relation.signs[t]
+                * values[relation.bases[2 * t]] * values[relation.bases[2 * t + 1]];
+            pattern = 3 * pattern + (term < 0 ? 2 : term);
+        }
+        for (int t = 0; t < 3; ++t) {
+            uint32_t X = masks[relation.bases[2 * t]] & masks[relation.bases[2 * t + 1]];
+            add_to_pair(masks[relation.bases[2 * t]] & ~X, 1 + term_classes[pattern][t]);
+            add_to_pair(masks[relation.bases[2 * t + 1]] & ~X, 1 + term_classes[pattern][t]);
+        }
+    }
+    for (int e = 0; e < N; ++e) {
+        for (int f = e + 1; f < N; ++f) {
+            for (int field = 1; field < 5; ++field) invariants[f][e][field] = invariants[e][f][field];
+        }
+    }
+    return invariants;
+}
+
+template<int N>
+void _refine_colors(std::array<int, N>& colors, const _PairInvariants<N>& invariants) {
+    // The signature of an element is its color and invariants, followed
+    // by the sorted list of the colors of the other elements paired with
+    // their invariants with the element.
+    using Entry = std::pair<int, std::array<uint32_t, 5>>;
+    using Signature = std::array<Entry, N>;
+    int nr_colors = -1;
+    while (true) {
+        std::array<Signature, N> signatures;
+        for (int e = 0; e < N; ++e) {
+            signatures[e][0] = {colors[e], invariants[e][e]};
+            int k = 1;
+            for (int f = 0; f < N; ++f) {
+                if (f != e) signatures[e][k++] = {colors[f], invariants[e][f]};
+            }
+            std::sort(signatures[e].begin() + 1, signatures[e].end());
+        }
+        std::array<int, N> order;
+        std::iota(order.begin(), order.end(), 0);
+        std::sort(order.begin(), order.end(), [&signatures](int e, int f) {
+            return signatures[e] < signatures[f];
+        });
+        int new_nr_colors = 0;
+        for (int i = 0; i < N; ++i) {
+            if (i > 0 && signatures[order[i]] != signatures[order[i - 1]]) ++new_nr_colors;
+            colors[order[i]] = new_nr_colors;
+        }
+        ++new_nr_colors;
+        if (new_nr_colors == nr_colors) return;
+        nr_colors = new_nr_colors;
+    }
+}
+
+template<int N>
+bool _are_twins(const _PairInvariants<N>& invariants, int e, int f) {
+    bool e_is_loop = invariants[e][e][0] == 0, f_is_loop = invariants[f][f][0] == 0;
+    return e_is_loop ? f_is_loop : !f_is_loop && invariants[e][f][0] == 0;
+}
+
+template<int N, typename AreTwins, typename Leaf>
+void _for_each_refined_relabeling(
+    std::array<int, N> colors,
+    const _PairInvariants<N>& invariants,
+    AreTwins&& are_twins,
+    Leaf&& leaf
+) {
+    _refine_colors<N>(colors, invariants);
+    std::array<int, N> cell_sizes{};
+    for (int e = 0; e < N; ++e) ++cell_sizes[colors[e]];
+    int cell = 0;
+    while (cell < N && cell_sizes[cell] <= 1) ++cell;
+    if (cell == N) {
+        leaf(std::as_const(colors));
+        return;
+    }
+    // Individualize each element of the first nontrivial cell in turn:
+    // it keeps the color of the cell, and the other elements of the
+    // cell and those of larger colors are moved up by one. Elements
+    // which are twins of an element already individualized are skipped.
+    std::vector<int> individualized_elements;
+    for (int e = 0; e < N; ++e) {
+        if (colors[e] != cell) continue;
+        if (std::any_of(individualized_elements.begin(), individualized_elements.end(),
+            [&](int f) { return are_twins(f, e); }
+        )) continue;
+        individualized_elements.push_back(e);
+        std::array<int, N> individualized = colors;
+        for (int f = 0; f < N; ++f) {
+            if (colors[f] > cell || (colors[f] == cell && f != e)) ++individualized[f];
+        }
+        _for_each_refined_relabeling<N>(individualized, invariants, are_twins, leaf);
+    }
+}
+
+}
@@ -0,0 +1,144 @@
+#pragma once
+
+#include <cstdint>
+#include <array>
+#include <vector>
+#include "OMs.hpp"
+#include "OMoperations.hpp"
+#include "signvectors.hpp"
+#include "parallel.hpp"
+
+namespace OM_operations {
+
+// ========
+// CIRCUITS
+// ========
+
+// Computes the list of circuits of a nonzero chirotope. From each pair
+// of circuits `C`, `-C` only one is included in the list.
+//
+// For an `R+1`-tuple `x_0 < ... < x_R` of elements, the signs
+// `C(x_i) = (-1)^i chi(x_0, ..., x_(i-1), x_(i+1), ..., x_R)` form a
+// circuit if the tuple spans the chirotope, and are zero otherwise.
+// Every circuit arises in this way (by completing it to a spanning
+// `R+1`-tuple), so the tuples are gathered in one pass, and a circuit
+// is kept if no earlier tuple gave the same support.
+template<int R, int N>
+std::vector<sign_vector<N>> circuits(const Chirotope<R, N>&);
+
+// =========
+// COVECTORS
+// =========
+
+// The covectors of a chirotope sorted by rank, together with the face
+// lattice they form: the rank of a covector is `R` minus the rank of
+// the set on which it vanishes, and a covector `X` is below `Y` if `Y`
+// agrees with `X` wherever `X` is nonzero. The zero vector has rank
+// `0`, the cocircuits (with both signs) have rank `1`, and the topes
+// rank `R`.
+template<int N>
+struct FaceLattice {
+    // `covectors[k]` lists the covectors of rank `k`, for `k` in `0..R`.
+    std::vector<std::vector<sign_vector<N>>> covectors;
+    // `covered[k][i]` lists the indices in `covectors[k-1]` of the
+    // covectors covered by `covectors[k][i]`, in increasing order. The
+    // entries of `covered[0]` are empty.
+    std::vector<std::vector<std::vector<uint32_t>>> covered;
+};
+
+// Computes the covectors of a nonzero chirotope rank by rank: those of
+// rank `k+1` are the compositions `X * C` of the covectors `X` of rank
+// `k` with the cocircuits `C` (of both signs), which have rank `k+1`.
+// Each covector of rank `k+1` covering `X` is such a composition, since
+// it is the composition of the cocircuits below it. The compositions
+// of each rank are distributed over `nr_threads` threads by `X`, and
+// deduplicated with a hash map. The order of the results does not
+// depend on the number of threads.
+template<int R, int N>
+std::vector<std::vector<sign_vector<N>>> covectors_by_rank(
+    const Chirotope<R, N>&,
+    unsigned nr_threads = parallel::default_number_of_threads()
+);
+
+// Same as `covectors_by_rank`, but also records which covectors cover
+// which (see `FaceLattice`): `X * C` covers `X` whenever it has rank
+// one more than `X`, and every covering relation arises this way.
+template<int R, int N>
+FaceLattice<N> face_lattice(
+    const Chirotope<R, N>&,
+    unsigned nr_threads = parallel::default_number_of_threads()
+);
+
+// Returns the number of covectors of each rank of a nonzero chirotope
+// (see `covectors_by_rank`).
+template<int R, int N>
+std::array<size_t, R + 1> covector_counts(
+    const Chirotope<R, N>&,
+    unsigned nr_threads = parallel::default_number_of_threads()
+);
+
+// =====
+// TOPES
+// =====
+
+// Calls `callback(thread_idx, tope)` for every tope of a nonzero
+// chirotope, i.e. every covector which is nonzero on all nonloops,
+// where `thread_idx` is as in `parallel::for_each_index_on_thread`.
+// The calls happen concurrently, in no particular order, and without
+// storing the topes.
+//
+// The signs of the nonloops are chosen one by one, and a partial choice
+// is abandoned as soon as it agrees with a circuit (or its negative) on
+// the whole support of the circuit. A partial choice which survives is
+// a tope of the deletion of the remaining elements, which extends to a
+// tope of the chirotope, so no branch of the search is a dead end.
+// Only the topes which are positive on the first nonloop are searched
+// for, and each is reported together with its negative. The searches
+// below the choices of the first few signs are distributed over
+// `nr_threads` threads.
+template<int R, int N, typename Callback>
+void for_each_tope(
+    const Chirotope<R, N>&,
+    Callback&& callback,
+    unsigned nr_threads = parallel::default_number_of_threads()
+);
+
+// Returns the topes of a nonzero chirotope, sorted by their words of
+// `plus` (see `for_each_tope`).
+template<int R, int N>
+std::vector<sign_vector<N>> topes(
+    const Chirotope<R, N>&,
+    unsigned nr_threads = parallel::default_number_of_threads()
+);
+
+// Returns the number of topes of a nonzero chirotope, without storing
+// them (see `for_each_tope`).
+template<int R, int N>
+size_t number_of_topes(
+    const Chirotope<R, N>&,
+    unsigned nr_threads = parallel::default_number_of_threads()
+);
+
+// =========
+// INTERNALS
+// =========
+
+// Computes the covectors of rank `rank + 1` from the given covectors of
+// rank `rank` and the given cocircuits of both signs, as described in
+// `covectors_by_rank`. If `covered` is not `nullptr`, the covering
+// relations are written to it as in `FaceLattice::covered`.
+template<int R, int N>
+std::vector<sign_vector<N>> _next_rank_of_covectors(
+    const Chirotope<R, N>& chi,
+    const std::vector<sign_vector<N>>& signed_cocircuits,
+    const std::vector<sign_vector<N>>& covectors_of_rank,
+    int rank,
+    std::vector<std::vector<uint32_t>>* covered,
+    unsigned nr_threads
+);
+
+}
+
+// This file declares templates, so their implementations must
+// be in this same header file as well.
+#include "covectors_impl.hpp"
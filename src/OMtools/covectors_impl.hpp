@@ -0,0 +1,298 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <span>
+#include <unordered_map>
+#include <unordered_set>
+#include "covectors.hpp"
+
+namespace OM_operations {
+
+// ========
+// CIRCUITS
+// ========
+
+template<int R, int N>
+std::vector<sign_vector<N>> circuits(const Chirotope<R, N>& chi) {
+    static_assert(N <= 32, "Sets of elements are stored as 32-bit masks.");
+    std::vector<sign_vector<N>> circuits_so_far{};
+    if constexpr (R < N) {
+        using RTUPLES = Chirotope<R, N>::RTUPLES; // R-tuples
+        using R1TUPLES = Rtuples::RTUPLES<char,R+1,N,int>; // (R+1)-tuples
+        // `bases[idx][i]` is the index of the `R`-tuple obtained by
+        // leaving out the `i`th element of the `idx`th `R+1`-tuple.
+        static constexpr auto bases{[]() constexpr {
+            std::array<std::array<int, R+1>, R1TUPLES::NR> bases{};
+            for (int idx = 0; idx < R1TUPLES::NR; ++idx) {
+                std::array<char, R+1> R1tuple = R1TUPLES::LIST::array[idx];
+                for (int i = 0; i <= R; ++i) {
+                    std::array<char, R> Rtuple{};
+                    for (int t = 0, s = 0; t <= R; ++t) {
+                        if (t != i) Rtuple[s++] = R1tuple[t];
+                    }
+                    bases[idx][i] = RTUPLES::index_of_ordered(Rtuple);
+                }
+            }
+            return bases;
+        }()};
+        // The supports of `circuits_so_far`.
+        std::vector<uint32_t> supports{};
+        for (int idx = 0; idx < R1TUPLES::NR; ++idx) {
+            const std::array<char, R+1>& R1tuple = R1TUPLES::LIST::array[idx];
+            uint32_t plus = 0;
+            uint32_t minus = 0;
+            for (int i = 0; i <= R; ++i) {
+                int basis = bases[idx][i];
+                uint32_t is_plus = (chi.plus[basis / 32] >> (basis % 32)) & 1;
+                uint32_t is_minus = (chi.minus[basis / 32] >> (basis % 32)) & 1;
+                if (i % 2) std::swap(is_plus, is_minus);
+                plus |= is_plus << R1tuple[i];
+                minus |= is_minus << R1tuple[i];
+            }
+            uint32_t support = plus | minus;
+            if (support == 0) continue; // the tuple does not span
+            if (std::find(supports.begin(), supports.end(), support) != supports.end()) {
+                continue;
+            }
+            supports.push_back(support);
+            sign_vector<N> circuit{};
+            circuit.plus[0] = plus;
+            circuit.minus[0] = minus;
+            circuits_so_far.push_back(circuit);
+        }
+    }
+    return circuits_so_far;
+}
+
+// =========
+// COVECTORS
+// =========
+
+template<int R, int N>
+std::vector<sign_vector<N>> _next_rank_of_covectors(
+    const Chirotope<R, N>& chi,
+    const std::vector<sign_vector<N>>& signed_cocircuits,
+    const std::vector<sign_vector<N>>& covectors_of_rank,
+    int rank,
+    std::vector<std::vector<uint32_t>>* covered,
+    unsigned nr_threads
+) {
+    // `compositions[x]` lists the distinct compositions of
+    // `covectors_of_rank[x]` with the cocircuits, other than itself.
+    std::vector<std::vector<sign_vector<N>>> compositions(covectors_of_rank.size());
+    parallel::for_each_index(0, covectors_of_rank.size(), [&](size_t x) {
+        std::unordered_set<sign_vector<N>> seen;
+        for (const auto& cocircuit : signed_cocircuits) {
+            auto composition = covectors_of_rank[x].composed(cocircuit);
+            if (composition == covectors_of_rank[x]) continue;
+            if (seen.insert(composition).second) compositions[x].push_back(composition);
+        }
+    }, nr_threads, 16);
+    // Number the distinct compositions in the order they were found.
+    std::unordered_map<sign_vector<N>, uint32_t> index_of;
+    std::vector<sign_vector<N>> distinct;
+    std::vector<std::vector<uint32_t>> indices_of_compositions(compositions.size());
+    for (size_t x = 0; x < compositions.size(); ++x) {
+        for (const auto& composition : compositions[x]) {
+            auto [itr, is_new] = index_of.emplace(composition, distinct.size());
+            if (is_new) distinct.push_back(composition);
+            indices_of_compositions[x].push_back(itr->second);
+        }
+    }
+    // Only the compositions of rank `rank + 1` cover the covector they
+    // were composed from; the others are found again later.
+    std::vector<char> is_of_next_rank(distinct.size());
+    parallel::for_each_index(0, distinct.size(), [&](size_t i) {
+        std::array<char, N> zeros;
+        int nr_zeros = 0;
+        for (int e = 0; e < N; ++e) {
+            if (distinct[i].is_zero(e)) zeros[nr_zeros++] = e;
+        }
+        is_of_next_rank[i] = chi.rank(std::span<const char>(zeros.data(), nr_zeros), R - rank)
+            == R - rank - 1;
+    }, nr_threads, 64);
+    std::vector<int64_t> new_index(distinct.size(), -1);
+    std::vector<sign_vector<N>> covectors_of_next_rank;
+    for (size_t i = 0; i < distinct.size(); ++i) {
+        if (!is_of_next_rank[i]) continue;
+        new_index[i] = covectors_of_next_rank.size();
+        covectors_of_next_rank.push_back(distinct[i]);
+    }
+    if (covered != nullptr) {
+        covered->assign(covectors_of_next_rank.size(), std::vector<uint32_t>());
+        for (uint32_t x = 0; x < indices_of_compositions.size(); ++x) {
+            for (auto i : indices_of_compositions[x]) {
+                if (new_index[i] >= 0) (*covered)[new_index[i]].push_back(x);
+            }
+        }
+    }
+    return covectors_of_next_rank;
+}
+
+template<int R, int N>
+std::vector<std::vector<sign_vector<N>>> covectors_by_rank(
+    const Chirotope<R, N>& chi,
+    unsigned nr_threads
+) {
+    std::vector<sign_vector<N>> signed_cocircuits;
+    for (const auto& cocircuit : cocircuits(chi)) {
+        signed_cocircuits.push_back(cocircuit);
+        signed_cocircuits.push_back(cocircuit.inverse());
+    }
+    std::vector<std::vector<sign_vector<N>>> covectors{{sign_vector<N>()}};
+    for (int rank = 0; rank < R; ++rank) {
+        auto covectors_of_next_rank = _next_rank_of_covectors(
+            chi, signed_cocircuits, covectors[rank], rank, nullptr, nr_threads
+        );
+        covectors.push_back(std::move(covectors_of_next_rank));
+    }
+    return covectors;
+}
+
+template<int R, int N>
+FaceLattice<N> face_lattice(
+    const Chirotope<R, N>& chi,
+    unsigned nr_threads
+) {
+    std::vector<sign_vector<N>> signed_cocircuits;
+    for (const auto& cocircuit : cocircuits(chi)) {
+        signed_cocircuits.push_back(cocircuit);
+        signed_cocircuits.push_back(cocircuit.inverse());
+    }
+    FaceLattice<N> lattice{{{sign_vector<N>()}}, {{std::vector<uint32_t>()}}};
+    for (int rank = 0; rank < R; ++rank) {
+        std::vector<std::vector<uint32_t>> covered;
+        auto covectors_of_next_rank = _next_rank_of_covectors(
+            chi, signed_cocircuits, lattice.covectors[rank], rank, &covered, nr_threads
+        );
+        lattice.covectors.push_back(std::move(covectors_of_next_rank));
+        lattice.covered.push_back(std::move(covered));
+    }
+    return lattice;
+}
+
+template<int R, int N>
+std::array<size_t, R + 1> covector_counts(
+    const Chirotope<R, N>& chi,
+    unsigned nr_threads
+) {
+    auto covectors = covectors_by_rank(chi, nr_threads);
+    std::array<size_t, R + 1> counts;
+    for (int rank = 0; rank <= R; ++rank) counts[rank] = covectors[rank].size();
+    return counts;
+}
+
+// =====
+// TOPES
+// =====
+
+template<int R, int N, typename Callback>
+void for_each_tope(
+    const Chirotope<R, N>& chi,
+    Callback&& callback,
+    unsigned nr_threads
+) {
+    static_assert(N <= 32, "Sets of elements are stored as 32-bit masks.");
+    std::vector<int> nonloops;
+    uint32_t loops = 0;
+    for (int e = 0; e < N; ++e) {
+        if (chi.is_loop(e)) {
+            loops |= uint32_t(1) << e;
+        } else {
+            nonloops.push_back(e);
+        }
+    }
+    if (nonloops.empty()) return;
+    // `closed_by[j]` lists the circuits (as masks of `+`s and `-`s) whose
+    // largest element is `nonloops[j]`, which are checked once the sign
+    // of `nonloops[j]` is chosen. Loops are left out.
+    std::vector<std::vector<std::array<uint32_t, 2>>> closed_by(nonloops.size());
+    for (const auto& circuit : circuits(chi)) {
+        uint32_t support = circuit.plus[0] | circuit.minus[0];
+        if (support & loops) continue;
+        int largest = 31 - std::countl_zero(support);
+        size_t j = std::find(nonloops.begin(), nonloops.end(), largest) - nonloops.begin();
+        closed_by[j].push_back({circuit.plus[0], circuit.minus[0]});
+    }
+    // The signs of `nonloops[1..nr_fixed]` are fixed by the bits of the
+    // index of the search, so that the searches can run in parallel.
+    int nr_fixed = 0;
+    if (parallel::effective_number_of_threads(nr_threads) > 1) {
+        while (nr_fixed + 1 < (int)nonloops.size()
+        && (size_t(1) << nr_fixed) < 8 * (size_t)nr_threads) {
+            ++nr_fixed;
+        }
+    }
+    parallel::for_each_index_on_thread(0, size_t(1) << nr_fixed, 
+    [&](unsigned thread_idx, size_t fixed_signs) {
+        auto extend = [&](auto& self, size_t j, uint32_t plus, uint32_t minus) -> void {
+            if (j == nonloops.size()) {
+                sign_vector<N> tope{};
+                tope.plus[0] = plus;
+                tope.minus[0] = minus;
+                callback(thread_idx, tope);
+                callback(thread_idx, tope.inverse());
+                return;
+            }
+            const uint32_t bit = uint32_t(1) << nonloops[j];
+            for (int is_minus = 0; is_minus < 2; ++is_minus) {
+                if (j == 0 && is_minus) break;
+                if (j >= 1 && j <= (size_t)nr_fixed 
+                && is_minus != (int)((fixed_signs >> (j - 1)) & 1)) {
+                    continue;
+                }
+                uint32_t new_plus = is_minus ? plus : plus | bit;
+                uint32_t new_minus = is_minus ? minus | bit : minus;
+                bool agrees_with_a_circuit = false;
+                for (const auto& [circuit_plus, circuit_minus] : closed_by[j]) {
+                    if (((new_plus & circuit_minus) | (new_minus & circuit_plus)) == 0
+                    || ((new_plus & circuit_plus) | (new_minus & circuit_minus)) == 0) {
+                        agrees_with_a_circuit = true;
+                        break;
+                    }
+                }
+                if (!agrees_with_a_circuit) self(self, j + 1, new_plus, new_minus);
+            }
+        };
+        extend(extend, 0, 0, 0);
+    }, nr_threads);
+}
+
+template<int R, int N>
+std::vector<sign_vector<N>> topes(
+    const Chirotope<R, N>& chi,
+    unsigned nr_threads
+) {
+    std::vector<std::vector<sign_vector<N>>> topes_per_thread(
+        parallel::effective_number_of_threads(nr_threads)
+    );
+    for_each_tope(chi, [&](unsigned thread_idx, const sign_vector<N>& tope) {
+        topes_per_thread[thread_idx].push_back(tope);
+    }, nr_threads);
+    std::vector<sign_vector<N>> all_topes;
+    for (const auto& topes_of_thread : topes_per_thread) {
+        all_topes.insert(all_topes.end(), topes_of_thread.begin(), topes_of_thread.end());
+    }
+    std::sort(all_topes.begin(), all_topes.end(), 
+    [](const sign_vector<N>& l, const sign_vector<N>& r) {
+        return l.plus[0] < r.plus[0];
+    });
+    return all_topes;
+}
+
+template<int R, int N>
+size_t number_of_topes(
+    const Chirotope<R, N>& chi,
+    unsigned nr_threads
+) {
+    std::vector<size_t> counts_per_thread(parallel::effective_number_of_threads(nr_threads), 0);
+    for_each_tope(chi, [&](unsigned thread_idx, const sign_vector<N>&) {
+        ++counts_per_thread[thread_idx];
+    }, nr_threads);
+    size_t count = 0;
+    for (auto count_of_thread : counts_per_thread) count += count_of_thread;
+    return count;
+}
+
+}
@@ -29,6 +29,23 @@ inline std::string OM_set<3,7>(int n_bases, int idx) {
     return std::format("../../../resources/oriented_matroid_sets/r3n7/OMs_rank3_7elements_{0}bases_part{1}.txt", n_bases, idx + 1);
 }
 
+// `binary_OM_set<R, N>(n_bases)` returns the name of the file of the
+// binary database (see `BinaryOMDatabaseWriter`) which contains rank
+// `R` chirotopes on `N` elements with `n_bases` many bases.
+template<int R, int N>
+std::string binary_OM_set(int n_bases) {
+    return std::format("../../../resources/oriented_matroid_sets/r{0}n{1}_binary/OMs_rank{0}_{1}elements_{2}bases.bin", R, N, n_bases);
+}
+
+// `binary_fixed_OM_set<R, N>(group_name, n_bases)` returns the name of
+// the file of the binary database which contains the rank `R` chirotopes
+// on `N` elements with `n_bases` many bases that are fixed by the group
+// called `group_name` (see `OM_operations::for_each_fixed_chirotope`).
+template<int R, int N>
+std::string binary_fixed_OM_set(const std::string& group_name, int n_bases) {
+    return std::format("../../../resources/fixed_oriented_matroid_sets/r{0}n{1}_{2}_binary/fixed_OMs_rank{0}_{1}elements_group_{2}_{3}bases.bin", R, N, group_name, n_bases);
+}
+
 template<int R, int N>
 std::string matroid_set(int n_bases, int idx) {
     if (idx != 0) return "";
@@ -41,4 +58,9 @@ std::string uniform_Finschi = std::format("../../../resources/Finschi_representa
 template<int R, int N>
 std::string all_Finschi = std::format("../../../resources/Finschi_representatives/all/r{}n{}.txt", R, N);
 
+// The file to which `programs::compute_cone_statistics_using_database<R,N>`
+// writes the face vectors of all lower and upper cones.
+template<int R, int N>
+std::string cone_statistics = std::format("../../../resources/oriented_matroid_relations/cone_statistics_r{}n{}.txt", R, N);
+
 }
\ No newline at end of file
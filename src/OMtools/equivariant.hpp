@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstdint>
+#include <array>
+#include <vector>
+#include "OMs.hpp"
+#include "posets.hpp"
+#include "permutationgroups.hpp"
+#include "parallel.hpp"
+
+// =================
+// LEFSCHETZ NUMBERS
+// =================
+
+// A permutation of the elements acts on a set of oriented matroids by
+// relabeling (see `OM_operations::relabel_elements`), and an oriented
+// matroid is fixed if the relabeled chirotope is the same or inverse.
+// If the set is invariant, then by the Hopf trace formula the Lefschetz
+// number of the action on the order complex of the weak map poset is
+// the Euler characteristic of the order complex of the fixed subposet,
+// and the same holds for the lower and upper cones of fixed elements.
+template<int R, int N>
+struct EquivariantData {
+    // The permutation acting.
+    Permutation<N> permutation;
+    // The fixed oriented matroids, in nondecreasing order of basecount.
+    std::vector<Chirotope<R, N>> fixed_elements;
+    // The Lefschetz number of the action on the whole poset.
+    long long lefschetz_number;
+    // `lower_cone_lefschetz_numbers[i]` is the Lefschetz number of the
+    // action on the strict lower cone of `fixed_elements[i]`,
+    // and similarly for upper cones.
+    std::vector<long long> lower_cone_lefschetz_numbers;
+    std::vector<long long> upper_cone_lefschetz_numbers;
+};
+
+// Returns the increasing list of indices of the oriented matroids of
+// `OMs` fixed by the given permutation. The oriented matroids are
+// distributed over `nr_threads` threads.
+template<int R, int N>
+std::vector<uint32_t> fixed_elements(
+    const std::vector<Chirotope<R, N>>& OMs,
+    const Permutation<N>& permutation,
+    unsigned nr_threads = parallel::default_number_of_threads()
+);
+
+// Computes the equivariant data of the action of every element of the
+// group on the weak map poset of the given oriented matroids, grouped
+// by basecount as in the constructor of `OMPoset`, which must be
+// invariant under the group, in the order of
+// `PermutationGroup::for_each_element`. For each element, the fixed
+// oriented matroids are found first, and only they are compared, by
+// the per-level parallel sweeps of an `OMPoset` of them computing the
+// cone face vectors (see `face_vector` in `ordercomplexes.hpp` for the
+// meaning of `dim_bound`). No comparabilities are stored, since the
+// identity fixes the whole poset, which gives the ordinary Euler
+// characteristics.
+template<int dim_bound, int R, int N>
+std::vector<EquivariantData<R, N>> equivariant_data(
+    const std::vector<std::vector<Chirotope<R, N>>>& OMs_by_basecount,
+    const PermutationGroup<N>& group,
+    unsigned nr_threads = parallel::default_number_of_threads()
+);
+
+// This file declares templates, so their implementations must
+// be in this same header file as well.
+#include "equivariant_impl.hpp"
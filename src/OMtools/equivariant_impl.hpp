@@ -0,0 +1,59 @@
+#pragma once
+
+#include "equivariant.hpp"
+#include "ordercomplexes.hpp"
+#include "relabelingkernels.hpp"
+
+// =================
+// LEFSCHETZ NUMBERS
+// =================
+
+template<int R, int N>
+std::vector<uint32_t> fixed_elements(
+    const std::vector<Chirotope<R, N>>& OMs,
+    const Permutation<N>& permutation,
+    unsigned nr_threads
+) {
+    OM_operations::RelabelingKernel<R, N> kernel(permutation);
+    std::vector<char> is_fixed(OMs.size());
+    parallel::for_each_index(0, OMs.size(), [&](size_t x) {
+        auto relabeled = kernel(OMs[x]);
+        is_fixed[x] = relabeled == OMs[x] || relabeled == OMs[x].inverse();
+    }, nr_threads, 256);
+    std::vector<uint32_t> fixed;
+    for (uint32_t x = 0; x < OMs.size(); ++x) {
+        if (is_fixed[x]) fixed.push_back(x);
+    }
+    return fixed;
+}
+
+template<int dim_bound, int R, int N>
+std::vector<EquivariantData<R, N>> equivariant_data(
+    const std::vector<std::vector<Chirotope<R, N>>>& OMs_by_basecount,
+    const PermutationGroup<N>& group,
+    unsigned nr_threads
+) {
+    std::vector<EquivariantData<R, N>> data;
+    group.for_each_element([&](const Permutation<N>& permutation) {
+        EquivariantData<R, N> entry;
+        entry.permutation = permutation;
+        std::vector<std::vector<Chirotope<R, N>>> fixed_by_basecount;
+        for (const auto& OMs : OMs_by_basecount) {
+            fixed_by_basecount.emplace_back();
+            for (auto x : fixed_elements<R, N>(OMs, permutation, nr_threads)) {
+                fixed_by_basecount.back().push_back(OMs[x]);
+            }
+        }
+        OMPoset<R, N> fixed_subposet(fixed_by_basecount, nr_threads);
+        entry.fixed_elements = fixed_subposet.elements;
+        auto lower = fixed_subposet.template lower_cone_face_vectors<dim_bound>(nr_threads);
+        auto upper = fixed_subposet.template upper_cone_face_vectors<dim_bound>(nr_threads);
+        entry.lefschetz_number = euler_characteristic<dim_bound>(face_vector<dim_bound>(lower));
+        for (size_t x = 0; x < fixed_subposet.size(); ++x) {
+            entry.lower_cone_lefschetz_numbers.push_back(euler_characteristic<dim_bound>(lower[x]));
+            entry.upper_cone_lefschetz_numbers.push_back(euler_characteristic<dim_bound>(upper[x]));
+        }
+        data.push_back(std::move(entry));
+    });
+    return data;
+}
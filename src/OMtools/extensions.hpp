@@ -0,0 +1,71 @@
+#pragma once
+
+#include <array>
+#include <vector>
+#include "OMs.hpp"
+#include "OMoperations.hpp"
+#include "signassignments.hpp"
+#include "parallel.hpp"
+
+namespace OM_operations {
+
+// =========================
+// SINGLE ELEMENT EXTENSIONS
+// =========================
+
+// The single element extensions of an oriented matroid by a new element
+// `p` correspond to its localizations: signatures `sigma` of its
+// cocircuits with `sigma(-C) = -sigma(C)`, where the extension satisfies
+// `chi'(x_1, ..., x_{R-1}, p) = sigma(C)` for the cocircuit `C` with
+// `C(e) = chi(x_1, ..., x_{R-1}, e)`. A signature defines an extension
+// if and only if its restriction to every rank 2 contraction does.
+
+// Returns a search (see `SignAssignmentSearch`) whose chirotopes are the
+// single element extensions of `chi` by the new element `N`: the values
+// on `R`-tuples not containing `N` are fixed to those of `chi`, every
+// pair `C, -C` of cocircuits of `chi` is a variable, and the `R`-tuples
+// `(x_1, ..., x_{R-1}, N)` are tied to the cocircuits they determine
+// (or fixed to `0` if `x_1, ..., x_{R-1}` are dependent). The three-term
+// Grassmann-Plucker relations propagated by the search are the rank 2
+// contraction consistency checks of the signature.
+template<int R, int N>
+SignAssignmentSearch<R, N + 1> single_element_extension_search(const Chirotope<R, N>& chi);
+
+// Calls `callback(thread_idx, chi1)` for every single element extension
+// `chi1` of `chi` by the new element `N`, including the extension by a
+// loop. The search is parallelized as in
+// `SignAssignmentSearch::for_each_chirotope`, so `callback` must be safe
+// to call concurrently.
+template<int R, int N, typename Callback>
+void for_each_single_element_extension(
+    const Chirotope<R, N>& chi,
+    Callback&& callback,
+    unsigned nr_threads = parallel::default_number_of_threads()
+);
+// Calls `callback(thread_idx, chi1)` for every single element extension
+// of every chirotope of `chis`. The chirotopes are distributed over
+// `nr_threads` threads, and each is extended on a single thread.
+template<int R, int N, typename Callback>
+void for_each_single_element_extension(
+    const ChirotopeArray<R, N>& chis,
+    Callback&& callback,
+    unsigned nr_threads = parallel::default_number_of_threads()
+);
+// Given one chirotope of every oriented matroid of rank `R` on `N`
+// elements up to isomorphism (see `canonical_form`), returns the
+// canonical forms of all oriented matroids of rank `R` on `N+1`
+// elements, sorted by `canonically_less`. Every such oriented matroid
+// has an element which is not a coloop (if `N+1 > R`), and deleting it
+// gives one of the given oriented matroids up to isomorphism, so it is
+// found among their single element extensions.
+template<int R, int N>
+ChirotopeArray<R, N + 1> extension_representatives(
+    const ChirotopeArray<R, N>& representatives,
+    unsigned nr_threads = parallel::default_number_of_threads()
+);
+
+}
+
+// This file declares templates, so their implementations must
+// be in this same header file as well.
+#include "extensions_impl.hpp"
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <unordered_map>
+#include <unordered_set>
+#include "extensions.hpp"
+#include "canonicalforms.hpp"
+
+namespace OM_operations {
+
+// =========================
+// SINGLE ELEMENT EXTENSIONS
+// =========================
+
+template<int R, int N>
+SignAssignmentSearch<R, N + 1> single_element_extension_search(const Chirotope<R, N>& chi) {
+    static_assert(N < 32, "Cocircuits are identified by their supports as 32-bit masks.");
+    using RTUPLES = Chirotope<R, N>::RTUPLES;
+    using RTUPLES1 = Chirotope<R, N + 1>::RTUPLES;
+    using R1TUPLES = Rtuples::RTUPLES<char, R - 1, N, int>;
+    SignAssignmentSearch<R, N + 1> search;
+    for (int b = 0; b < RTUPLES::NR; ++b) {
+        int b1 = RTUPLES1::index_of_ordered(RTUPLES::LIST::array[b]);
+        search.fix(b1, chi.get_plus(b) ? '+' : (chi.get_minus(b) ? '-' : '0'));
+    }
+    // The variable of each cocircuit, identified by its support, and the
+    // cocircuit chosen as its positive one.
+    std::unordered_map<uint32_t, int> variable_of_support;
+    std::vector<sign_vector<N>> positive_cocircuits;
+    for (int x = 0; x < R1TUPLES::NR; ++x) {
+        auto cocircuit = cocircuit_extractors_from_chirotope<R, N>[x] * chi;
+        if (cocircuit.is_zero()) continue;
+        uint32_t support = cocircuit.plus.bits[0] | cocircuit.minus.bits[0];
+        auto [it, inserted] = variable_of_support.emplace(support, positive_cocircuits.size());
+        if (inserted) {
+            search.add_variable();
+            positive_cocircuits.push_back(cocircuit);
+        }
+        std::array<char, R> Rtuple{};
+        for (int t = 0; t < R - 1; ++t) Rtuple[t] = R1TUPLES::LIST::array[x][t];
+        Rtuple[R - 1] = N;
+        int lowest = std::countr_zero(support);
+        bool opposite = (cocircuit.plus.bits[0] >> lowest & 1)
+            != (positive_cocircuits[it->second].plus.bits[0] >> lowest & 1);
+        search.tie(RTUPLES1::index_of_ordered(Rtuple), it->second, opposite);
+    }
+    return search;
+}
+
+template<int R, int N, typename Callback>
+void for_each_single_element_extension(
+    const Chirotope<R, N>& chi,
+    Callback&& callback,
+    unsigned nr_threads
+) {
+    single_element_extension_search(chi).for_each_chirotope(callback, nr_threads);
+}
+
+template<int R, int N, typename Callback>
+void for_each_single_element_extension(
+    const ChirotopeArray<R, N>& chis,
+    Callback&& callback,
+    unsigned nr_threads
+) {
+    parallel::for_each_index_on_thread(0, chis.size(), [&](unsigned thread_idx, size_t idx) {
+        for_each_single_element_extension(chis[idx], [&](unsigned, const Chirotope<R, N + 1>& chi1) {
+            callback(thread_idx, chi1);
+        }, 1);
+    }, nr_threads);
+}
+
+template<int R, int N>
+ChirotopeArray<R, N + 1> extension_representatives(
+    const ChirotopeArray<R, N>& representatives,
+    unsigned nr_threads
+) {
+    // Each thread collects the canonical forms it finds.
+    std::vector<std::unordered_set<Chirotope<R, N + 1>>> found(
+        parallel::effective_number_of_threads(nr_threads)
+    );
+    for_each_single_element_extension(representatives,
+    [&](unsigned thread_idx, const Chirotope<R, N + 1>& chi1) {
+        found[thread_idx].insert(canonical_form(chi1).chirotope);
+    }, nr_threads);
+    for (size_t thread_idx = 1; thread_idx < found.size(); ++thread_idx) {
+        found[0].merge(found[thread_idx]);
+    }
+    ChirotopeArray<R, N + 1> canonical_forms(found[0].begin(), found[0].end());
+    std::sort(canonical_forms.begin(), canonical_forms.end(), canonically_less<R, N + 1>);
+    return canonical_forms;
+}
+
+}
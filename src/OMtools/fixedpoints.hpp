@@ -0,0 +1,94 @@
+#pragma once
+
+#include <cstdint>
+#include <array>
+#include <string>
+#include <vector>
+#include "mymath.hpp"
+#include "OMs.hpp"
+#include "permutationgroups.hpp"
+#include "signassignments.hpp"
+#include "parallel.hpp"
+
+namespace OM_operations {
+
+// ============
+// FIXED POINTS
+// ============
+
+// An oriented matroid is fixed by a group of permutations if relabeling
+// it by any element `g` of the group (see `relabel_elements`) gives the
+// same oriented matroid, i.e. a chirotope `chi` is mapped to
+// `character(g) * chi` for a sign `character(g)`. For nonzero `chi` this
+// `character` is a homomorphism from the group to `{+1, -1}`, so it is
+// determined by its values on the generators of the group, which are
+// encoded as a mask: bit `k` is set if generator `k` maps `chi` to its
+// inverse.
+
+// The orbits of the `R`-tuples under a group of permutations, with the
+// signs relating the values of fixed chirotopes with a given character
+// on the elements of each orbit: if relabeling by a generator `g` maps
+// the `R`-tuple `b` to `b'` with the sign `s` of sorting, then
+// `chi(b') = character(g) * s * chi(b)`. If these relations give two
+// different signs for the same `R`-tuple, then every fixed chirotope
+// vanishes on the orbit.
+template<int R, int N>
+struct BasisOrbits {
+    // The number of `R`-tuples.
+    constexpr static const int NR = binomial_coefficient(N, R);
+
+    // The number of orbits on which fixed chirotopes need not vanish.
+    int size;
+    // `orbit_of[b]` is the index of the orbit of the `R`-tuple `b`, or
+    // `-1` if fixed chirotopes vanish on it.
+    std::array<int, NR> orbit_of;
+    // `chi(b) = sign_in_orbit[b] * chi(b0)` for every fixed chirotope
+    // `chi`, where `b0` is the first `R`-tuple of the orbit of `b`.
+    std::array<int, NR> sign_in_orbit;
+
+    // Computes the orbits for the given group and character.
+    BasisOrbits(const PermutationGroup<N>& group, uint32_t character);
+};
+
+// Returns a search (see `SignAssignmentSearch`) whose chirotopes are
+// the chirotopes fixed by the group with the given character: every
+// orbit of `BasisOrbits` is a variable, and only one of two opposite
+// chirotopes is produced.
+template<int R, int N>
+SignAssignmentSearch<R, N> fixed_chirotope_search(const PermutationGroup<N>& group, uint32_t character);
+
+// Calls `callback(thread_idx, chi)` once for every nonzero chirotope
+// `chi` fixed by the group, up to inversion, searching each character
+// separately. The searches are parallelized as in
+// `SignAssignmentSearch::for_each_chirotope`, so `callback` must be
+// safe to call concurrently. Throws `std::invalid_argument` if the group
+// has 32 or more generators, since characters are 32-bit masks.
+template<int R, int N, typename Callback>
+void for_each_fixed_chirotope(
+    const PermutationGroup<N>& group,
+    Callback&& callback,
+    unsigned nr_threads = parallel::default_number_of_threads()
+);
+// Returns the chirotopes found by `for_each_fixed_chirotope`, grouped by
+// basecount, where the index is shifted by 1 from the actual basecount.
+// The order of the output does not depend on the number of threads.
+template<int R, int N>
+std::vector<ChirotopeArray<R, N>> fixed_chirotopes_by_basecount(
+    const PermutationGroup<N>& group,
+    unsigned nr_threads = parallel::default_number_of_threads()
+);
+// Writes the chirotopes found by `for_each_fixed_chirotope` to a binary
+// OM database with the given paths (see `BinaryOMDatabaseWriter`), and
+// returns their number.
+template<int R, int N>
+uint64_t write_fixed_chirotopes_to_binary_database(
+    const PermutationGroup<N>& group,
+    std::string (*path_of)(int),
+    unsigned nr_threads = parallel::default_number_of_threads()
+);
+
+}
+
+// This file declares templates, so their implementations must
+// be in this same header file as well.
+#include "fixedpoints_impl.hpp"
@@ -0,0 +1,129 @@
+#pragma once
+
+#include <algorithm>
+#include <format>
+#include <mutex>
+#include <stdexcept>
+#include "fixedpoints.hpp"
+#include "OM_IO.hpp"
+#include "canonicalforms.hpp"
+
+namespace OM_operations {
+
+// ============
+// FIXED POINTS
+// ============
+
+template<int R, int N>
+BasisOrbits<R, N>::BasisOrbits(const PermutationGroup<N>& group, uint32_t character): size(0) {
+    using RTUPLES = Chirotope<R, N>::RTUPLES;
+    const auto& generators = group.generators();
+    // `image[k][b]` is the `R`-tuple to which generator `k` maps `b`,
+    // and `image_sign[k][b]` is the sign relating their values.
+    std::vector<std::array<int, NR>> image(generators.size()), image_sign(generators.size());
+    for (size_t k = 0; k < generators.size(); ++k) {
+        int character_sign = (character >> k & 1) ? -1 : 1;
+        for (int b = 0; b < NR; ++b) {
+            std::array<char, R> mapped_Rtuple{};
+            for (int t = 0; t < R; ++t) mapped_Rtuple[t] = generators[k][RTUPLES::LIST::array[b][t]];
+            auto sgn_and_idx = RTUPLES::sign_and_index_of_unordered(mapped_Rtuple);
+            image[k][b] = sgn_and_idx.second;
+            image_sign[k][b] = character_sign * sgn_and_idx.first;
+        }
+    }
+    // `sign[b]` is `0` until `b` is reached, and then the sign relating
+    // the value on `b` to that on the first element of its orbit.
+    std::array<int, NR> sign{};
+    std::vector<int> orbit;
+    for (int b0 = 0; b0 < NR; ++b0) {
+        if (sign[b0] != 0) continue;
+        orbit.assign(1, b0);
+        sign[b0] = 1;
+        bool vanishes = false;
+        for (size_t i = 0; i < orbit.size(); ++i) {
+            int b = orbit[i];
+            for (size_t k = 0; k < generators.size(); ++k) {
+                int b1 = image[k][b];
+                if (sign[b1] == 0) {
+                    sign[b1] = image_sign[k][b] * sign[b];
+                    orbit.push_back(b1);
+                } else if (sign[b1] != image_sign[k][b] * sign[b]) {
+                    vanishes = true;
+                }
+            }
+        }
+        for (int b : orbit) {
+            orbit_of[b] = vanishes ? -1 : size;
+            sign_in_orbit[b] = vanishes ? 0 : sign[b];
+        }
+        if (!vanishes) ++size;
+    }
+}
+
+template<int R, int N>
+SignAssignmentSearch<R, N> fixed_chirotope_search(const PermutationGroup<N>& group, uint32_t character) {
+    BasisOrbits<R, N> orbits(group, character);
+    SignAssignmentSearch<R, N> search;
+    search.identify_inverses = true;
+    for (int orbit = 0; orbit < orbits.size; ++orbit) search.add_variable();
+    for (int b = 0; b < orbits.NR; ++b) {
+        if (orbits.orbit_of[b] >= 0) search.tie(b, orbits.orbit_of[b], orbits.sign_in_orbit[b] == -1);
+    }
+    return search;
+}
+
+template<int R, int N, typename Callback>
+void for_each_fixed_chirotope(
+    const PermutationGroup<N>& group,
+    Callback&& callback,
+    unsigned nr_threads
+) {
+    const size_t k = group.generators().size();
+    if (k >= 32) throw std::invalid_argument(std::format(
+        "The characters of a group with {0} generators do not fit into 32-bit masks.", k
+    ));
+    for (uint32_t character = 0; character < (uint32_t(1) << k); ++character) {
+        fixed_chirotope_search<R, N>(group, character).for_each_chirotope(
+        [&](unsigned thread_idx, const Chirotope<R, N>& chi) {
+            if (!chi.is_zero()) callback(thread_idx, chi);
+        }, nr_threads);
+    }
+}
+
+template<int R, int N>
+std::vector<ChirotopeArray<R, N>> fixed_chirotopes_by_basecount(
+    const PermutationGroup<N>& group,
+    unsigned nr_threads
+) {
+    std::vector<ChirotopeArray<R, N>> by_basecount(binomial_coefficient(N, R));
+    std::mutex mutex;
+    for_each_fixed_chirotope<R, N>(group, [&](unsigned, const Chirotope<R, N>& chi) {
+        std::lock_guard<std::mutex> lock(mutex);
+        by_basecount[chi.countbases() - 1].push_back(chi);
+    }, nr_threads);
+    // Make the order independent of the scheduling of the threads.
+    for (auto& chirotopes : by_basecount) {
+        std::sort(chirotopes.begin(), chirotopes.end(), canonically_less<R, N>);
+    }
+    return by_basecount;
+}
+
+template<int R, int N>
+uint64_t write_fixed_chirotopes_to_binary_database(
+    const PermutationGroup<N>& group,
+    std::string (*path_of)(int),
+    unsigned nr_threads
+) {
+    BinaryOMDatabaseWriter<R, N> writer(path_of);
+    std::mutex mutex;
+    uint64_t total = 0;
+    for_each_fixed_chirotope<R, N>(group, [&](unsigned, const Chirotope<R, N>& chi) {
+        std::lock_guard<std::mutex> lock(mutex);
+        writer.write(chi);
+        ++total;
+    }, nr_threads);
+    writer.close();
+    return total;
+}
+
+}
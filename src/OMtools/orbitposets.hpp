@@ -0,0 +1,96 @@
+#pragma once
+
+#include <cstdint>
+#include <array>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "mymath.hpp"
+#include "OMs.hpp"
+#include "ordercomplexes.hpp"
+#include "parallel.hpp"
+
+// The poset of oriented matroids of rank `R` on `N` elements ordered by
+// weak maps (as in `OMPoset`), stored up to relabeling and reorientation
+// of the elements. These act on the poset preserving weak maps, so the
+// lower cones of isomorphic oriented matroids are isomorphic, and every
+// count over the poset is a sum over the isomorphism classes weighted by
+// the sizes of their orbits (Burnside's lemma).
+//
+// Each class is represented by its `canonical_form`. The classes are
+// stored in nondecreasing order of basecount, and for every class the
+// number of oriented matroids of each class strictly below its
+// representative is precomputed; only the representatives are ever
+// compared, so the labelled oriented matroids are never listed.
+template<int R, int N>
+struct OrbitPoset {
+    // The number of `R`-tuples, i.e. the largest possible basecount.
+    constexpr static const int NR = binomial_coefficient(N, R);
+
+    // The canonical forms of the classes, in nondecreasing order of
+    // basecount.
+    std::vector<Chirotope<R, N>> representatives;
+    // The classes with `b` bases have indices `level_start[b]..level_start[b+1]-1`.
+    std::vector<uint32_t> level_start;
+    // `orbit_sizes[i]` is the number of oriented matroids in class `i`
+    // (see `OM_operations::orbit_size`).
+    std::vector<uint64_t> orbit_sizes;
+    // `smaller[i]` lists the pairs `(j, m)` such that `m > 0` oriented
+    // matroids of class `j` are strictly below `representatives[i]`,
+    // in increasing order of `j`.
+    std::vector<std::vector<std::pair<uint32_t, uint64_t>>> smaller;
+
+    // Creates an empty poset.
+    OrbitPoset();
+    // Creates the poset of all weak map images of the given oriented
+    // matroids and of those isomorphic to them. For example, the uniform
+    // representatives of Finschi's lists give all oriented matroids of
+    // rank 3. The lower cone of every class is enumerated by a
+    // `SignAssignmentSearch`, and its elements are sorted into classes
+    // by their canonical forms; the classes are distributed over
+    // `nr_threads` threads.
+    OrbitPoset(
+        const std::vector<Chirotope<R, N>>& tops,
+        unsigned nr_threads = parallel::default_number_of_threads()
+    );
+
+    // Returns the number of classes.
+    size_t size() const
+    { return representatives.size(); }
+    // Returns the number of bases of the class with the given index.
+    int basecount(size_t idx) const;
+    // Returns the number of oriented matroids in the poset.
+    uint64_t number_of_OMs() const;
+    // Returns the index of the class of `chi`, or `-1` if `chi` is not
+    // in the poset.
+    long long class_of(const Chirotope<R, N>& chi) const;
+
+    // =================
+    // CONE FACE VECTORS
+    // =================
+
+    // Computes, for every class, the face vector of the order complex of
+    // the strict lower cone of its representative (see `face_vector` in
+    // `ordercomplexes.hpp` for the meaning of `dim_bound`), which is that
+    // of every oriented matroid in the class. The levels are swept in
+    // increasing order of basecount, and the classes of each level are
+    // distributed over `nr_threads` threads.
+    template<int dim_bound>
+    std::vector<std::array<size_t, dim_bound>> lower_cone_face_vectors(
+        unsigned nr_threads = parallel::default_number_of_threads()
+    ) const;
+    // Returns the face vector of the order complex of the whole poset,
+    // given the output of `lower_cone_face_vectors`, by weighting each
+    // class with its orbit size.
+    template<int dim_bound>
+    std::array<size_t, dim_bound> face_vector(
+        const std::vector<std::array<size_t, dim_bound>>& lower_cone_face_vectors
+    ) const;
+
+private:
+    std::unordered_map<Chirotope<R, N>, uint32_t> index_of_representative;
+};
+
+// This file declares templates, so their implementations must
+// be in this same header file as well.
+#include "orbitposets_impl.hpp"
@@ -0,0 +1,135 @@
+#pragma once
+
+#include <algorithm>
+#include <mutex>
+#include <unordered_set>
+#include "orbitposets.hpp"
+#include "canonicalforms.hpp"
+#include "orbits.hpp"
+#include "signassignments.hpp"
+
+// Calls `callback(chi)` for every chirotope strictly below `top`, up to
+// inversion, on the calling thread.
+template<int R, int N, typename Callback>
+void _for_each_strictly_below(const Chirotope<R, N>& top, Callback&& callback) {
+    using SEARCH = SignAssignmentSearch<R, N>;
+    SEARCH search;
+    for (int b = 0; b < SEARCH::NR; ++b) {
+        if (top.get_plus(b)) search.tie(b, search.add_variable(SEARCH::ZERO | SEARCH::PLUS));
+        else if (top.get_minus(b)) search.tie(b, search.add_variable(SEARCH::ZERO | SEARCH::MINUS));
+    }
+    search.for_each_chirotope([&](unsigned, const Chirotope<R, N>& chi) {
+        if (!chi.is_zero() && chi != top) callback(chi);
+    }, 1);
+}
+
+template<int R, int N>
+OrbitPoset<R, N>::OrbitPoset(): level_start(NR + 2, 0) {}
+
+template<int R, int N>
+OrbitPoset<R, N>::OrbitPoset(
+    const std::vector<Chirotope<R, N>>& tops,
+    unsigned nr_threads
+): level_start(NR + 2, 0) {
+    // The classes below each top, counted by canonical form. Every class
+    // is below a top, so this finds all classes, and the counts of the
+    // classes of the tops need not be computed again.
+    using Counts = std::unordered_map<Chirotope<R, N>, uint64_t>;
+    auto count_below = [](const Chirotope<R, N>& top) {
+        Counts counts;
+        _for_each_strictly_below(top, [&](const Chirotope<R, N>& chi) {
+            ++counts[OM_operations::canonical_form(chi).chirotope];
+        });
+        return counts;
+    };
+    std::vector<Chirotope<R, N>> canonical_tops(tops.size());
+    std::vector<Counts> counts_below_tops(tops.size());
+    parallel::for_each_index(0, tops.size(), [&](size_t idx) {
+        canonical_tops[idx] = OM_operations::canonical_form(tops[idx]).chirotope;
+        counts_below_tops[idx] = count_below(tops[idx]);
+    }, nr_threads, 1);
+
+    std::unordered_set<Chirotope<R, N>> classes(canonical_tops.begin(), canonical_tops.end());
+    for (const auto& counts : counts_below_tops) {
+        for (const auto& [canonical, count] : counts) classes.insert(canonical);
+    }
+    representatives.assign(classes.begin(), classes.end());
+    std::sort(representatives.begin(), representatives.end(), [](const auto& chi1, const auto& chi2) {
+        int b1 = chi1.countbases(), b2 = chi2.countbases();
+        return b1 != b2 ? b1 < b2 : OM_operations::canonically_less(chi1, chi2);
+    });
+    for (uint32_t idx = 0; idx < representatives.size(); ++idx) {
+        index_of_representative.emplace(representatives[idx], idx);
+    }
+    for (int b = 1; b <= NR + 1; ++b) {
+        level_start[b] = std::lower_bound(representatives.begin(), representatives.end(), b,
+        [](const auto& chi, int b) { return chi.countbases() < b; }) - representatives.begin();
+    }
+
+    std::vector<const Counts*> counts_below(representatives.size(), nullptr);
+    for (size_t idx = 0; idx < tops.size(); ++idx) {
+        auto& counts = counts_below[index_of_representative.at(canonical_tops[idx])];
+        if (counts == nullptr) counts = &counts_below_tops[idx];
+    }
+    orbit_sizes.assign(representatives.size(), 0);
+    smaller.assign(representatives.size(), {});
+    parallel::for_each_index(0, representatives.size(), [&](size_t idx) {
+        orbit_sizes[idx] = OM_operations::orbit_size(representatives[idx]);
+        Counts computed;
+        if (counts_below[idx] == nullptr) computed = count_below(representatives[idx]);
+        const Counts& counts = counts_below[idx] ? *counts_below[idx] : computed;
+        for (const auto& [canonical, count] : counts) {
+            smaller[idx].emplace_back(index_of_representative.at(canonical), count);
+        }
+        std::sort(smaller[idx].begin(), smaller[idx].end());
+    }, nr_threads, 1);
+}
+
+template<int R, int N>
+int OrbitPoset<R, N>::basecount(size_t idx) const {
+    return std::upper_bound(level_start.begin(), level_start.end(), idx)
+        - level_start.begin() - 1;
+}
+
+template<int R, int N>
+uint64_t OrbitPoset<R, N>::number_of_OMs() const {
+    uint64_t total = 0;
+    for (auto orbit_size : orbit_sizes) total += orbit_size;
+    return total;
+}
+
+template<int R, int N>
+long long OrbitPoset<R, N>::class_of(const Chirotope<R, N>& chi) const {
+    auto it = index_of_representative.find(OM_operations::canonical_form(chi).chirotope);
+    return it == index_of_representative.end() ? -1 : it->second;
+}
+
+// =================
+// CONE FACE VECTORS
+// =================
+
+template<int R, int N>
+template<int dim_bound>
+std::vector<std::array<size_t, dim_bound>> OrbitPoset<R, N>::lower_cone_face_vectors(
+    unsigned nr_threads
+) const {
+    std::vector<std::array<size_t, dim_bound>> face_vectors(representatives.size());
+    for (int b = 1; b <= NR; ++b) {
+        parallel::for_each_index(level_start[b], level_start[b + 1], [&](size_t x) {
+            face_vectors[x] = weighted_face_vector<dim_bound>(face_vectors, smaller[x]);
+        }, nr_threads, 64);
+    }
+    return face_vectors;
+}
+
+template<int R, int N>
+template<int dim_bound>
+std::array<size_t, dim_bound> OrbitPoset<R, N>::face_vector(
+    const std::vector<std::array<size_t, dim_bound>>& lower_cone_face_vectors
+) const {
+    std::vector<std::pair<uint32_t, uint64_t>> weighted_classes;
+    for (uint32_t idx = 0; idx < representatives.size(); ++idx) {
+        weighted_classes.emplace_back(idx, orbit_sizes[idx]);
+    }
+    return weighted_face_vector<dim_bound>(lower_cone_face_vectors, weighted_classes);
+}
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <array>
+#include <vector>
+#include "OMs.hpp"
+#include "OMoperations.hpp"
+#include "canonicalforms.hpp"
+#include "relabelingkernels.hpp"
+#include "parallel.hpp"
+
+namespace OM_operations {
+
+// ======
+// ORBITS
+// ======
+
+// Returns the one of `chi` and `chi.inverse()` whose first nonzero value
+// is `+`. Databases store one chirotope of every oriented matroid, and
+// the orbit expansion below chooses it this way.
+template<int R, int N>
+Chirotope<R, N> sign_normalized(const Chirotope<R, N>& chi);
+
+// Calls `callback(chi)` once for every chirotope `chi` which can be
+// obtained from `representative` by relabeling and reorienting, up to
+// inversion: only the `sign_normalized` one of two opposite chirotopes
+// is produced.
+//
+// The relabelings are enumerated in the Steinhaus-Johnson-Trotter order,
+// so that each one is obtained from the previous one by the kernel of
+// an adjacent transposition (see `relabeling_kernel`). Each is reduced
+// to its `canonical_reorientation`, and these are deduplicated in a
+// hash set. Each reorientation class is then expanded by reorienting
+// one nonloop element at a time in Gray code order, and deduplicated
+// in another hash set, since reorienting a union of components gives
+// the same chirotope (up to inversion).
+template<int R, int N, typename Callback>
+void for_each_in_orbit(const Chirotope<R, N>& representative, Callback&& callback);
+// Returns the orbit of `representative` as in `for_each_in_orbit`.
+template<int R, int N>
+ChirotopeArray<R, N> orbit(const Chirotope<R, N>& representative);
+
+// Returns the number of chirotopes produced by `for_each_in_orbit`,
+// without enumerating them: `N! * 2^k / (|A| * i)`, where `A` is the
+// `automorphism_group` of `chi` including reorientations, `k` is the
+// number of `SpanningBases` of its underlying matroid, so that `2^k` is
+// the number of its reorientations, and `i` is `2` if `chi.inverse()`
+// is one of them and `1` otherwise.
+template<int R, int N>
+uint64_t orbit_size(const Chirotope<R, N>& chi);
+
+// Calls `callback(thread_idx, chi)` for every chirotope in the orbits
+// of the given representatives, as in `for_each_in_orbit`. The
+// representatives must be pairwise non-isomorphic, otherwise orbits are
+// produced several times (see `remove_isomorphic_duplicates`). The
+// representatives are distributed over `nr_threads` threads, so
+// `callback` must be safe to call concurrently.
+template<int R, int N, typename Callback>
+void for_each_in_orbits(
+    const ChirotopeArray<R, N>& representatives,
+    Callback&& callback,
+    unsigned nr_threads = parallel::default_number_of_threads()
+);
+
+// Returns the chirotopes of the list with distinct canonical forms (see
+// `canonical_form`), keeping the first of each isomorphism class. The
+// canonical forms are computed on `nr_threads` threads.
+template<int R, int N>
+ChirotopeArray<R, N> remove_isomorphic_duplicates(
+    const ChirotopeArray<R, N>& chis,
+    unsigned nr_threads = parallel::default_number_of_threads()
+);
+
+// Expands the orbits of the given pairwise non-isomorphic representatives
+// on `nr_threads` threads, and writes them to a binary OM database with
+// the given paths (see `BinaryOMDatabaseWriter`). Returns the total
+// number of chirotopes written.
+template<int R, int N>
+uint64_t write_orbits_to_binary_database(
+    const ChirotopeArray<R, N>& representatives,
+    std::string (*path_of)(int),
+    unsigned nr_threads = parallel::default_number_of_threads()
+);
+
+}
+
+// This file declares templates, so their implementations must
+// be in this same header file as well.
+#include "orbits_impl.hpp"
@@ -0,0 +1,179 @@
+#pragma once
+
+#include <bit>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include "orbits.hpp"
+#include "OM_IO.hpp"
+
+namespace OM_operations {
+
+// ======
+// ORBITS
+// ======
+
+template<int R, int N>
+Chirotope<R, N> sign_normalized(const Chirotope<R, N>& chi) {
+    for (int i = 0; i < Chirotope<R, N>::NR_INT32; ++i) {
+        uint32_t nonzeros = chi.plus[i] | chi.minus[i];
+        if (nonzeros == 0) continue;
+        return (chi.minus[i] & nonzeros & -nonzeros) ? chi.inverse() : chi;
+    }
+    return chi;
+}
+
+template<int R, int N, typename Callback>
+void for_each_in_orbit(const Chirotope<R, N>& representative, Callback&& callback) {
+    // The kernels of the adjacent transpositions `(k, k+1)`.
+    std::array<const RelabelingKernel<R, N>*, N> transpositions{};
+    for (int k = 0; k + 1 < N; ++k) {
+        std::array<int, N> permutation;
+        for (int e = 0; e < N; ++e) permutation[e] = e;
+        std::swap(permutation[k], permutation[k + 1]);
+        transpositions[k] = &relabeling_kernel<R, N>(permutation);
+    }
+    std::unordered_map<Matroid<R, N>, SpanningBases<R, N>> spanning_bases;
+    auto canonical_reorientation_up_to_inversion = [&](const Chirotope<R, N>& chi) {
+        auto matroid = chi.underlying_matroid();
+        auto it = spanning_bases.find(matroid);
+        if (it == spanning_bases.end()) it = spanning_bases.emplace(matroid, SpanningBases<R, N>(matroid)).first;
+        const auto& bases = it->second;
+        auto canonical = reorient_elements_in_mask<R, N>(bases.reoriented_elements(chi))(chi);
+        if constexpr (R % 2 == 1) {
+            // The inverse is the reorientation of all elements.
+            return canonical;
+        } else {
+            auto inverse = chi.inverse();
+            auto canonical_inverse = reorient_elements_in_mask<R, N>(bases.reoriented_elements(inverse))(inverse);
+            return canonically_less(canonical_inverse, canonical) ? canonical_inverse : canonical;
+        }
+    };
+
+    // Relabelings in the Steinhaus-Johnson-Trotter order: `elements` lists
+    // the elements by their label, and the largest mobile label (one whose
+    // direction points to a smaller neighbour) is moved in each step.
+    std::unordered_set<Chirotope<R, N>> reorientation_classes;
+    std::array<int, N> elements, position, direction;
+    for (int e = 0; e < N; ++e) {
+        elements[e] = e;
+        position[e] = e;
+        direction[e] = -1;
+    }
+    Chirotope<R, N> relabeled = representative;
+    reorientation_classes.insert(canonical_reorientation_up_to_inversion(relabeled));
+    while (true) {
+        int mobile = -1;
+        for (int e = N - 1; e >= 0 && mobile == -1; --e) {
+            int neighbour = position[e] + direction[e];
+            if (neighbour >= 0 && neighbour < N && elements[neighbour] < e) mobile = e;
+        }
+        if (mobile == -1) break;
+        int k = std::min(position[mobile], position[mobile] + direction[mobile]);
+        std::swap(elements[k], elements[k + 1]);
+        position[elements[k]] = k;
+        position[elements[k + 1]] = k + 1;
+        for (int e = mobile + 1; e < N; ++e) direction[e] = -direction[e];
+        relabeled = (*transpositions[k])(relabeled);
+        reorientation_classes.insert(canonical_reorientation_up_to_inversion(relabeled));
+    }
+
+    std::array<svo::Multiply<Chirotope<R, N>>, N> reorientations;
+    for (int e = 0; e < N; ++e) reorientations[e] = reorient_element<R, N>(e);
+    std::unordered_set<Chirotope<R, N>> reoriented;
+    for (const auto& chi: reorientation_classes) {
+        std::vector<int> nonloops;
+        for (int e = 0; e < N; ++e) {
+            if (!chi.is_loop(e)) nonloops.push_back(e);
+        }
+        reoriented.clear();
+        Chirotope<R, N> current = chi;
+        reoriented.insert(sign_normalized(current));
+        for (uint64_t step = 1; step < ((uint64_t)1 << nonloops.size()); ++step) {
+            current = reorientations[nonloops[std::countr_zero(step)]](current);
+            reoriented.insert(sign_normalized(current));
+        }
+        for (const auto& result: reoriented) callback(result);
+    }
+}
+
+template<int R, int N>
+ChirotopeArray<R, N> orbit(const Chirotope<R, N>& representative) {
+    ChirotopeArray<R, N> chis;
+    for_each_in_orbit(representative, [&chis](const Chirotope<R, N>& chi) {
+        chis.push_back(chi);
+    });
+    return chis;
+}
+
+template<int R, int N>
+uint64_t orbit_size(const Chirotope<R, N>& chi) {
+    uint64_t size = 1;
+    for (int n = 2; n <= N; ++n) size *= n;
+    size <<= SpanningBases<R, N>(chi.underlying_matroid()).size;
+    size /= automorphism_group(chi, true).order();
+    if (canonical_reorientation(chi) == canonical_reorientation(chi.inverse())) size /= 2;
+    return size;
+}
+
+template<int R, int N, typename Callback>
+void for_each_in_orbits(
+    const ChirotopeArray<R, N>& representatives,
+    Callback&& callback,
+    unsigned nr_threads
+) {
+    parallel::for_each_index_on_thread(0, representatives.size(), [&](unsigned thread_idx, size_t idx) {
+        for_each_in_orbit(representatives[idx], [&](const Chirotope<R, N>& chi) {
+            callback(thread_idx, chi);
+        });
+    }, nr_threads);
+}
+
+template<int R, int N>
+ChirotopeArray<R, N> remove_isomorphic_duplicates(
+    const ChirotopeArray<R, N>& chis,
+    unsigned nr_threads
+) {
+    std::vector<Chirotope<R, N>> canonical_forms(chis.size());
+    parallel::for_each_index(0, chis.size(), [&](size_t idx) {
+        canonical_forms[idx] = canonical_form(chis[idx]).chirotope;
+    }, nr_threads, 64);
+    std::unordered_set<Chirotope<R, N>> seen;
+    ChirotopeArray<R, N> distinct;
+    for (size_t idx = 0; idx < chis.size(); ++idx) {
+        if (seen.insert(canonical_forms[idx]).second) distinct.push_back(chis[idx]);
+    }
+    return distinct;
+}
+
+template<int R, int N>
+uint64_t write_orbits_to_binary_database(
+    const ChirotopeArray<R, N>& representatives,
+    std::string (*path_of)(int),
+    unsigned nr_threads
+) {
+    // Each thread buffers its chirotopes, and flushes them to the writer
+    // when the buffer is full and after each orbit.
+    constexpr size_t BUFFER_SIZE = 1 << 16;
+    BinaryOMDatabaseWriter<R, N> writer(path_of);
+    std::mutex writer_mutex;
+    uint64_t total = 0;
+    auto flush = [&](ChirotopeArray<R, N>& buffer) {
+        std::lock_guard<std::mutex> lock(writer_mutex);
+        for (const auto& chi: buffer) writer.write(chi);
+        total += buffer.size();
+        buffer.clear();
+    };
+    parallel::for_each_index(0, representatives.size(), [&](size_t idx) {
+        ChirotopeArray<R, N> buffer;
+        for_each_in_orbit(representatives[idx], [&](const Chirotope<R, N>& chi) {
+            buffer.push_back(chi);
+            if (buffer.size() == BUFFER_SIZE) flush(buffer);
+        });
+        flush(buffer);
+    }, nr_threads, 1);
+    writer.close();
+    return total;
+}
+
+}
@@ -93,7 +93,8 @@ std::vector<size_t> bigger_OMs(
 // The elements of the poset are labelled `0..N-1`, and
 // - `face_vectors_of_lower_cones[i]` is the face vector of the
 //   lower cone of the `i`th element of `P`,
-// - `indices_of_elements` lists the elements of `S`.
+// - `indices_of_elements` lists the elements of `S`; it may be any
+//   container of integers iterable with a range-based for loop.
 //
 // All face vectors are stored as `std::array<size_t, dim_bound>`,
 // where `f[i]` is the count of `i`-dimensional simplices. Simplices
@@ -101,10 +102,10 @@ std::vector<size_t> bigger_OMs(
 //
 // Note: `face_vectors_of_lower_cones` can be computed recursively
 // using this function.
-template<int dim_bound>
+template<int dim_bound, typename Indices>
 std::array<size_t, dim_bound> face_vector(
     const std::vector<std::array<size_t, dim_bound>>& face_vectors_of_lower_cones,
-    const std::vector<size_t>& indices_of_elements
+    const Indices& indices_of_elements
 ) {
     static_assert(dim_bound > 0, "The number of entries allocated to store the face vectors must be positive!");
     std::array<size_t, dim_bound> f; f.fill(0);
@@ -132,3 +133,24 @@ static_assert(dim_bound > 0, "The number of entries allocated to store the face
     }
     return f;
 }
+
+// Like `face_vector(face_vectors_of_lower_cones, indices_of_elements)`,
+// but each element of `S` stands for several elements with the same
+// lower cone: `weighted_elements` lists pairs `(idx, multiplicity)`.
+// This computes face vectors of posets given up to symmetry, where
+// the elements of an orbit are represented by one of them.
+template<int dim_bound, typename WeightedIndices>
+std::array<size_t, dim_bound> weighted_face_vector(
+    const std::vector<std::array<size_t, dim_bound>>& face_vectors_of_lower_cones,
+    const WeightedIndices& weighted_elements
+) {
+    static_assert(dim_bound > 0, "The number of entries allocated to store the face vectors must be positive!");
+    std::array<size_t, dim_bound> f; f.fill(0);
+    for (const auto& [idx, multiplicity] : weighted_elements) {
+        f[0] += multiplicity;
+        for (auto d = 0; d < dim_bound - 1; d++) {
+            f[d+1] += multiplicity * face_vectors_of_lower_cones[idx][d];
+        }
+    }
+    return f;
+}
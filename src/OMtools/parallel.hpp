@@ -0,0 +1,140 @@
+#pragma once
+
+#include <cstddef>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Small helpers for distributing loops over several threads.
+//
+// Loops started from inside a loop of this namespace (for example,
+// a parallelised research function called from a parallel program)
+// run sequentially on the calling thread, so nesting them never
+// oversubscribes the machine.
+namespace parallel {
+
+// Is `true` on the worker threads started by this namespace.
+inline thread_local bool inside_parallel_region = false;
+
+// Returns the number of threads to use when nothing else was
+// specified: the number of hardware threads, or 1 if it is unknown.
+inline unsigned default_number_of_threads() {
+    unsigned nr = std::thread::hardware_concurrency();
+    return nr == 0 ? 1 : nr;
+}
+
+// Returns the number of threads a loop of this namespace actually
+// uses if `requested` threads were asked for. Use this to size
+// per-thread accumulators.
+inline unsigned effective_number_of_threads(unsigned requested) {
+    if (inside_parallel_region || requested == 0) return 1;
+    return requested;
+}
+
+// Calls `function(thread_idx, idx)` for every `idx` in `begin..end-1`,
+// where `thread_idx` is the index (in `0..effective_number_of_threads(nr_threads)-1`)
+// of the thread making the call. Indices are handed out in increasing
+// order, in blocks of `chunk_size`, to whichever thread is free, so
+// uneven workloads are balanced automatically.
+//
+// If `function` throws, the remaining indices are skipped, and the
+// first exception is rethrown on the calling thread.
+template<typename Function>
+void for_each_index_on_thread(
+    size_t begin,
+    size_t end,
+    Function&& function,
+    unsigned nr_threads = default_number_of_threads(),
+    size_t chunk_size = 1
+) {
+    if (begin >= end) return;
+    if (chunk_size == 0) chunk_size = 1;
+    nr_threads = effective_number_of_threads(nr_threads);
+    if (nr_threads == 1 || end - begin <= chunk_size) {
+        for (size_t idx = begin; idx < end; ++idx) function(0u, idx);
+        return;
+    }
+    std::atomic<size_t> next{begin};
+    std::atomic<bool> failed{false};
+    std::exception_ptr first_exception;
+    std::mutex exception_mutex;
+    auto work = [&](unsigned thread_idx) {
+        inside_parallel_region = true;
+        try {
+            while (!failed.load(std::memory_order_relaxed)) {
+                size_t from = next.fetch_add(chunk_size, std::memory_order_relaxed);
+                if (from >= end) break;
+                size_t to = (end - from < chunk_size) ? end : from + chunk_size;
+                for (size_t idx = from; idx < to; ++idx) function(thread_idx, idx);
+            }
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(exception_mutex);
+            if (!first_exception) first_exception = std::current_exception();
+            failed = true;
+        }
+        inside_parallel_region = false;
+    };
+    std::vector<std::thread> threads;
+    threads.reserve(nr_threads - 1);
+    for (unsigned t = 1; t < nr_threads; ++t) threads.emplace_back(work, t);
+    work(0);
+    for (auto& thread : threads) thread.join();
+    if (first_exception) std::rethrow_exception(first_exception);
+}
+
+// Calls `function(idx)` for every `idx` in `begin..end-1`, distributed
+// over `nr_threads` threads as in `for_each_index_on_thread`.
+template<typename Function>
+void for_each_index(
+    size_t begin,
+    size_t end,
+    Function&& function,
+    unsigned nr_threads = default_number_of_threads(),
+    size_t chunk_size = 1
+) {
+    for_each_index_on_thread(
+        begin, end,
+        [&function](unsigned, size_t idx) { function(idx); },
+        nr_threads, chunk_size
+    );
+}
+
+// Calls `function(idx, stream)` for every `idx` in `begin..end-1`,
+// distributed over `nr_threads` threads as in `for_each_index`, where
+// `stream` collects what the call prints. The collected text of each
+// index is written to `output` as soon as that of all smaller indices
+// is written, so the output is the same as that of a sequential loop,
+// while results still appear while the loop is running.
+template<typename Function>
+void for_each_index_with_ordered_output(
+    size_t begin,
+    size_t end,
+    Function&& function,
+    std::ostream& output,
+    unsigned nr_threads = default_number_of_threads()
+) {
+    if (begin >= end) return;
+    std::vector<std::string> texts(end - begin);
+    std::vector<bool> is_done(end - begin, false);
+    size_t next_to_write = begin;
+    std::mutex output_mutex;
+    for_each_index(begin, end, [&](size_t idx) {
+        std::ostringstream stream;
+        function(idx, static_cast<std::ostream&>(stream));
+        std::lock_guard<std::mutex> lock(output_mutex);
+        texts[idx - begin] = std::move(stream).str();
+        is_done[idx - begin] = true;
+        while (next_to_write < end && is_done[next_to_write - begin]) {
+            output << texts[next_to_write - begin] << std::flush;
+            texts[next_to_write - begin].clear();
+            ++next_to_write;
+        }
+    }, nr_threads);
+}
+
+}
@@ -0,0 +1,141 @@
+#pragma once
+
+#include <cstdint>
+#include <array>
+#include <vector>
+#include "OMs.hpp"
+#include "relabelingkernels.hpp"
+
+// A permutation of the elements `0..N-1`: `p[e]` is the image of `e`.
+// Acting on chirotopes, `p` relabels the element `e` to `p[e]`.
+template<int N>
+using Permutation = std::array<int, N>;
+
+// Returns the identity permutation.
+template<int N>
+constexpr Permutation<N> identity_permutation();
+// Returns the composition `p*q`, which first applies `q`, then `p`.
+template<int N>
+constexpr Permutation<N> compose_permutations(const Permutation<N>& p, const Permutation<N>& q);
+// Returns the inverse permutation.
+template<int N>
+constexpr Permutation<N> inverse_permutation(const Permutation<N>&);
+// Returns the permutation which maps `cycle[k]` to `cycle[k+1]` (and the
+// last element to the first one), and fixes all other elements.
+template<int N>
+Permutation<N> cycle_permutation(const std::vector<int>& cycle);
+
+// A group of permutations of the elements `0..N-1`, given by generators.
+//
+// On construction, a base and a strong generating set are computed by the
+// Schreier-Sims algorithm: for a sequence of base points `b_0, b_1, ...`,
+// level `i` stores generators of the subgroup `G_i` fixing `b_0..b_{i-1}`,
+// and for every point `x` of the orbit of `b_i` under `G_i` an element of
+// `G_i` mapping `b_i` to `x`. Every element of the group is a unique
+// product of such coset representatives, one from each level, which
+// gives the order, membership tests, and the enumeration of elements
+// without listing all `N!` permutations.
+template<int N>
+class PermutationGroup {
+public:
+    // Creates the trivial group.
+    PermutationGroup();
+    // Creates the group generated by the given permutations.
+    PermutationGroup(const std::vector<Permutation<N>>& generators);
+
+    // =============
+    // COMMON GROUPS
+    // =============
+
+    // The cyclic group `Z_n` rotating `offset..offset+n-1`.
+    static PermutationGroup cyclic(int n, int offset = 0);
+    // The group `Z_a x Z_b` acting regularly on `0..a*b-1`, where
+    // `i + a*j` stands for the pair `(i, j)`, and fixing the rest of
+    // `0..N-1`. Throws `std::invalid_argument` unless `a*b <= N`.
+    static PermutationGroup cyclic_product(int a, int b);
+    // The dihedral group of order `2n`, acting on `0..n-1` as on the
+    // vertices of a regular `n`-gon.
+    static PermutationGroup dihedral(int n);
+    // The group `Z_2^k` acting regularly on `0..2^k-1` by bitwise xor,
+    // and fixing the rest of `0..N-1`. Throws `std::invalid_argument`
+    // unless `2^k <= N`.
+    static PermutationGroup elementary_abelian_2_group(int k);
+    // The symmetric group of `0..n-1`.
+    static PermutationGroup symmetric(int n);
+
+    // ===============
+    // GROUP STRUCTURE
+    // ===============
+
+    // Returns the generators given on construction, except those which
+    // are products of the previous ones.
+    const std::vector<Permutation<N>>& generators() const
+    { return gens; }
+    // Returns the number of elements of the group.
+    uint64_t order() const;
+    // Returns whether the permutation is an element of the group.
+    bool contains(const Permutation<N>&) const;
+    // Returns the orbit of the element `point` of the ground set.
+    std::vector<int> orbit(int point) const;
+    // Returns the subgroup of permutations fixing `point`, generated by
+    // the Schreier generators of its orbit.
+    PermutationGroup stabilizer(int point) const;
+    // Calls `callback(p)` for every element `p` of the group.
+    template<typename Callback>
+    void for_each_element(Callback&& callback) const;
+    // Returns all elements of the group.
+    std::vector<Permutation<N>> elements() const;
+
+    // ====================
+    // ACTION ON CHIROTOPES
+    // ====================
+
+    // Returns the action of a permutation on rank `R` chirotopes: the
+    // relabeling by it (see `OM_operations::relabel_elements`), which
+    // includes the signs of sorting the relabeled `R`-tuples. The kernel
+    // is built anew, and not stored in the cache of
+    // `OM_operations::relabeling_kernel`, since the elements of a group
+    // are mostly used only once.
+    template<int R>
+    static OM_operations::RelabelingKernel<R, N> action(const Permutation<N>&);
+    // Returns whether every element of the group maps `chi` to itself.
+    template<int R>
+    bool fixes(const Chirotope<R, N>& chi) const;
+    // Returns the orbit of `chi` under the group.
+    template<int R>
+    ChirotopeArray<R, N> orbit(const Chirotope<R, N>& chi) const;
+    // Returns the subgroup of permutations mapping `chi` to itself. The
+    // orbit of `chi` is traversed using the generators, and the
+    // stabilizer is generated by the corresponding Schreier generators.
+    template<int R>
+    PermutationGroup stabilizer(const Chirotope<R, N>& chi) const;
+
+private:
+    struct Level {
+        int base_point;
+        // Generators of the subgroup fixing the previous base points.
+        std::vector<Permutation<N>> generators;
+        // `transversal[x]` is the index in `representatives` of an element
+        // mapping `base_point` to `x`, or `-1` if `x` is not in its orbit.
+        std::array<int, N> transversal;
+        std::vector<Permutation<N>> representatives;
+    };
+
+    std::vector<Permutation<N>> gens;
+    std::vector<Level> levels;
+
+    // Divides `g` from the left by coset representatives, starting at
+    // the given level, while possible. Returns the level at which this
+    // stopped; `g` is then the identity if it is in the subgroup of
+    // the given level.
+    int sift(Permutation<N>& g, int level) const;
+    // Adds `g`, which is in the stabilizer of the first `level` base
+    // points, to the generators of the given level, and extends the
+    // orbit of the level and the levels below it, so that every
+    // Schreier generator of the level sifts through the levels below.
+    void add_generator(int level, const Permutation<N>& g);
+};
+
+// This file declares templates, so their implementations must
+// be in this same header file as well.
+#include "permutationgroups_impl.hpp"
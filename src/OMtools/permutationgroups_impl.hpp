@@ -0,0 +1,309 @@
+#pragma once
+
+#include <format>
+#include <stdexcept>
+#include <unordered_map>
+#include <unordered_set>
+#include "permutationgroups.hpp"
+
+template<int N>
+constexpr Permutation<N> identity_permutation() {
+    Permutation<N> p;
+    for (int e = 0; e < N; ++e) p[e] = e;
+    return p;
+}
+
+template<int N>
+constexpr Permutation<N> compose_permutations(const Permutation<N>& p, const Permutation<N>& q) {
+    Permutation<N> pq;
+    for (int e = 0; e < N; ++e) pq[e] = p[q[e]];
+    return pq;
+}
+
+template<int N>
+constexpr Permutation<N> inverse_permutation(const Permutation<N>& p) {
+    Permutation<N> inverse;
+    for (int e = 0; e < N; ++e) inverse[p[e]] = e;
+    return inverse;
+}
+
+template<int N>
+Permutation<N> cycle_permutation(const std::vector<int>& cycle) {
+    auto p = identity_permutation<N>();
+    for (size_t k = 0; k < cycle.size(); ++k) p[cycle[k]] = cycle[(k + 1) % cycle.size()];
+    return p;
+}
+
+template<int N>
+PermutationGroup<N>::PermutationGroup() {}
+
+template<int N>
+PermutationGroup<N>::PermutationGroup(const std::vector<Permutation<N>>& generators) {
+    for (const auto& g : generators) {
+        if (contains(g)) continue;
+        gens.push_back(g);
+        add_generator(0, g);
+    }
+}
+
+// =============
+// COMMON GROUPS
+// =============
+
+template<int N>
+PermutationGroup<N> PermutationGroup<N>::cyclic(int n, int offset) {
+    std::vector<int> cycle;
+    for (int k = 0; k < n; ++k) cycle.push_back(offset + k);
+    return PermutationGroup({cycle_permutation<N>(cycle)});
+}
+
+template<int N>
+PermutationGroup<N> PermutationGroup<N>::cyclic_product(int a, int b) {
+    if (a < 1 || b < 1 || a * b > N) throw std::invalid_argument(std::format(
+        "Z_{0} x Z_{1} cannot act regularly on a subset of {2} elements.", a, b, N
+    ));
+    auto first = identity_permutation<N>(), second = identity_permutation<N>();
+    for (int i = 0; i < a; ++i) {
+        for (int j = 0; j < b; ++j) {
+            first[i + a * j] = (i + 1) % a + a * j;
+            second[i + a * j] = i + a * ((j + 1) % b);
+        }
+    }
+    return PermutationGroup({first, second});
+}
+
+template<int N>
+PermutationGroup<N> PermutationGroup<N>::dihedral(int n) {
+    std::vector<int> cycle;
+    for (int k = 0; k < n; ++k) cycle.push_back(k);
+    auto reflection = identity_permutation<N>();
+    for (int k = 0; k < n; ++k) reflection[k] = (n - k) % n;
+    return PermutationGroup({cycle_permutation<N>(cycle), reflection});
+}
+
+template<int N>
+PermutationGroup<N> PermutationGroup<N>::elementary_abelian_2_group(int k) {
+    if (k < 0 || k >= 31 || (1 << k) > N) throw std::invalid_argument(std::format(
+        "Z_2^{0} cannot act regularly on a subset of {1} elements.", k, N
+    ));
+    std::vector<Permutation<N>> generators;
+    for (int i = 0; i < k; ++i) {
+        auto p = identity_permutation<N>();
+        for (int x = 0; x < (1 << k); ++x) p[x] = x ^ (1 << i);
+        generators.push_back(p);
+    }
+    return PermutationGroup(generators);
+}
+
+template<int N>
+PermutationGroup<N> PermutationGroup<N>::symmetric(int n) {
+    if (n < 2) return PermutationGroup();
+    std::vector<int> cycle;
+    for (int k = 0; k < n; ++k) cycle.push_back(k);
+    return PermutationGroup({cycle_permutation<N>({0, 1}), cycle_permutation<N>(cycle)});
+}
+
+// ===============
+// GROUP STRUCTURE
+// ===============
+
+template<int N>
+uint64_t PermutationGroup<N>::order() const {
+    uint64_t order = 1;
+    for (const auto& level : levels) order *= level.representatives.size();
+    return order;
+}
+
+template<int N>
+bool PermutationGroup<N>::contains(const Permutation<N>& p) const {
+    auto residue = p;
+    sift(residue, 0);
+    return residue == identity_permutation<N>();
+}
+
+template<int N>
+std::vector<int> PermutationGroup<N>::orbit(int point) const {
+    std::vector<int> orbit{point};
+    std::array<bool, N> found{};
+    found[point] = true;
+    for (size_t k = 0; k < orbit.size(); ++k) {
+        for (const auto& g : gens) {
+            int image = g[orbit[k]];
+            if (found[image]) continue;
+            found[image] = true;
+            orbit.push_back(image);
+        }
+    }
+    return orbit;
+}
+
+template<int N>
+PermutationGroup<N> PermutationGroup<N>::stabilizer(int point) const {
+    if (!levels.empty() && levels[0].base_point == point) {
+        return levels.size() > 1 ? PermutationGroup(levels[1].generators) : PermutationGroup();
+    }
+    // `transversal[x]` maps `point` to `x`.
+    std::unordered_map<int, Permutation<N>> transversal{{point, identity_permutation<N>()}};
+    std::vector<int> orbit{point};
+    std::vector<Permutation<N>> schreier_generators;
+    for (size_t k = 0; k < orbit.size(); ++k) {
+        for (const auto& g : gens) {
+            auto image = compose_permutations<N>(g, transversal[orbit[k]]);
+            auto it = transversal.find(image[point]);
+            if (it == transversal.end()) {
+                transversal.emplace(image[point], image);
+                orbit.push_back(image[point]);
+            } else {
+                schreier_generators.push_back(compose_permutations<N>(inverse_permutation<N>(it->second), image));
+            }
+        }
+    }
+    return PermutationGroup(schreier_generators);
+}
+
+template<int N>
+template<typename Callback>
+void PermutationGroup<N>::for_each_element(Callback&& callback) const {
+    // `partial[i]` is the product of the representatives chosen at the
+    // levels before `i`, and `choice[i]` is the next one to try at `i`.
+    std::vector<Permutation<N>> partial(levels.size() + 1, identity_permutation<N>());
+    std::vector<size_t> choice(levels.size() + 1, 0);
+    int i = 0;
+    while (i >= 0) {
+        if (i == (int)levels.size()) {
+            callback(static_cast<const Permutation<N>&>(partial[i]));
+            --i;
+        } else if (choice[i] < levels[i].representatives.size()) {
+            partial[i + 1] = compose_permutations<N>(partial[i], levels[i].representatives[choice[i]++]);
+            choice[++i] = 0;
+        } else {
+            --i;
+        }
+    }
+}
+
+template<int N>
+std::vector<Permutation<N>> PermutationGroup<N>::elements() const {
+    std::vector<Permutation<N>> elements;
+    elements.reserve(order());
+    for_each_element([&](const Permutation<N>& p) { elements.push_back(p); });
+    return elements;
+}
+
+// ====================
+// ACTION ON CHIROTOPES
+// ====================
+
+template<int N>
+template<int R>
+OM_operations::RelabelingKernel<R, N> PermutationGroup<N>::action(const Permutation<N>& p) {
+    return OM_operations::RelabelingKernel<R, N>(p);
+}
+
+template<int N>
+template<int R>
+bool PermutationGroup<N>::fixes(const Chirotope<R, N>& chi) const {
+    for (const auto& g : gens) {
+        if (action<R>(g)(chi) != chi) return false;
+    }
+    return true;
+}
+
+template<int N>
+template<int R>
+ChirotopeArray<R, N> PermutationGroup<N>::orbit(const Chirotope<R, N>& chi) const {
+    std::vector<OM_operations::RelabelingKernel<R, N>> actions;
+    for (const auto& g : gens) actions.push_back(action<R>(g));
+    ChirotopeArray<R, N> orbit{chi};
+    std::unordered_set<Chirotope<R, N>> found{chi};
+    for (size_t k = 0; k < orbit.size(); ++k) {
+        for (const auto& g_action : actions) {
+            auto image = g_action(orbit[k]);
+            if (found.insert(image).second) orbit.push_back(image);
+        }
+    }
+    return orbit;
+}
+
+template<int N>
+template<int R>
+PermutationGroup<N> PermutationGroup<N>::stabilizer(const Chirotope<R, N>& chi) const {
+    // `transversal[x]` maps `chi` to `x`.
+    std::unordered_map<Chirotope<R, N>, Permutation<N>> transversal{{chi, identity_permutation<N>()}};
+    ChirotopeArray<R, N> orbit{chi};
+    std::vector<Permutation<N>> schreier_generators;
+    std::vector<OM_operations::RelabelingKernel<R, N>> actions;
+    for (const auto& g : gens) actions.push_back(action<R>(g));
+    for (size_t k = 0; k < orbit.size(); ++k) {
+        const auto to_current = transversal[orbit[k]];
+        for (size_t i = 0; i < gens.size(); ++i) {
+            const auto& g = gens[i];
+            auto image = actions[i](orbit[k]);
+            auto p = compose_permutations<N>(g, to_current);
+            auto it = transversal.find(image);
+            if (it == transversal.end()) {
+                transversal.emplace(image, p);
+                orbit.push_back(image);
+            } else {
+                schreier_generators.push_back(compose_permutations<N>(inverse_permutation<N>(it->second), p));
+            }
+        }
+    }
+    return PermutationGroup(schreier_generators);
+}
+
+// =============
+// SCHREIER-SIMS
+// =============
+
+template<int N>
+int PermutationGroup<N>::sift(Permutation<N>& g, int level) const {
+    for (; level < (int)levels.size(); ++level) {
+        const auto& L = levels[level];
+        int index = L.transversal[g[L.base_point]];
+        if (index == -1) return level;
+        g = compose_permutations<N>(inverse_permutation<N>(L.representatives[index]), g);
+    }
+    return level;
+}
+
+template<int N>
+void PermutationGroup<N>::add_generator(int level, const Permutation<N>& g) {
+    if (level == (int)levels.size()) {
+        Level L;
+        L.base_point = 0;
+        while (g[L.base_point] == L.base_point) ++L.base_point;
+        L.transversal.fill(-1);
+        L.transversal[L.base_point] = 0;
+        L.representatives.push_back(identity_permutation<N>());
+        levels.push_back(L);
+    }
+    levels[level].generators.push_back(g);
+    // Every pair of an orbit point and a generator is processed once:
+    // either it extends the orbit, or it gives a Schreier generator of
+    // the next level, which is added there unless it sifts through.
+    // The orbit points found before `g` are only paired with `g`.
+    std::vector<std::pair<int, int>> pairs;
+    for (size_t k = 0; k < levels[level].representatives.size(); ++k) {
+        pairs.emplace_back(k, levels[level].generators.size() - 1);
+    }
+    while (!pairs.empty()) {
+        auto [k, s] = pairs.back();
+        pairs.pop_back();
+        // `levels` may grow below, so the level is looked up every time.
+        auto p = compose_permutations<N>(levels[level].generators[s], levels[level].representatives[k]);
+        int image = p[levels[level].base_point];
+        int index = levels[level].transversal[image];
+        if (index == -1) {
+            levels[level].transversal[image] = levels[level].representatives.size();
+            levels[level].representatives.push_back(p);
+            for (size_t t = 0; t < levels[level].generators.size(); ++t) {
+                pairs.emplace_back(levels[level].representatives.size() - 1, t);
+            }
+        } else {
+            auto residue = compose_permutations<N>(inverse_permutation<N>(levels[level].representatives[index]), p);
+            sift(residue, level + 1);
+            if (residue != identity_permutation<N>()) add_generator(level + 1, residue);
+        }
+    }
+}
@@ -0,0 +1,185 @@
+#pragma once
+
+#include <cstdint>
+#include <array>
+#include <span>
+#include <vector>
+#include "mymath.hpp"
+#include "OMs.hpp"
+#include "ordercomplexes.hpp"
+#include "parallel.hpp"
+
+// A finite set of oriented matroids of rank `R` on `N` elements,
+// partially ordered by weak maps (`x <= y` if `y.OM_weak_maps_to(x)`).
+//
+// The elements are stored in nondecreasing order of basecount, which
+// is a linear extension of the weak map order; elements with the same
+// basecount form a level, and are pairwise incomparable. While the
+// elements are compared, `mu(0, x)` is computed for every element `x`
+// (see `mobius_from_bottom`). A poset created by `with_comparabilities`
+// also keeps, for every element, the (increasing) list of indices of
+// the elements strictly below it, so that later sweeps over lower cones
+// do not need to compare chirotopes again. This takes 4 bytes per
+// comparable pair, so it is only meant for small posets, such as
+// intervals, cones, or `MacP(3,6)`.
+template<int R, int N>
+struct OMPoset {
+    // The number of `R`-tuples, i.e. the largest possible basecount.
+    constexpr static const int NR = binomial_coefficient(N, R);
+
+    // The elements of the poset, in nondecreasing order of basecount.
+    std::vector<Chirotope<R, N>> elements;
+    // The elements with `b` bases have indices `level_start[b]..level_start[b+1]-1`.
+    std::vector<uint32_t> level_start;
+    // `smaller[i]` is the increasing list of indices of the elements
+    // strictly below `elements[i]`. Empty unless the comparabilities
+    // are stored, which `is_strictly_below` and `mobius` require; the
+    // sweeps and chain searches compare the chirotopes instead when
+    // they are missing.
+    std::vector<std::vector<uint32_t>> smaller;
+    // `mu_from_bottom[i]` is `mu(0, i)` (see `mobius_from_bottom`).
+    std::vector<long long> mu_from_bottom;
+
+    // Creates an empty poset.
+    OMPoset();
+    // Creates the poset of the given oriented matroids, grouped by
+    // basecount with the index shifted by 1 from the actual basecount
+    // (as returned by `research::generate_lower_cone`). Each OM must
+    // appear at most once. The levels are processed in increasing order
+    // of basecount: each element is compared only to the elements of
+    // lower levels, and `mu(0, x)` is summed up during the comparisons.
+    // The elements of each level are distributed over `nr_threads`
+    // threads. The comparabilities are not kept, so only 8 bytes are
+    // stored per element besides the chirotopes.
+    OMPoset(
+        const std::vector<std::vector<Chirotope<R, N>>>& OMs_by_basecount,
+        unsigned nr_threads = parallel::default_number_of_threads()
+    );
+    // Same as the constructor, but also keeps the lists `smaller`.
+    static OMPoset with_comparabilities(
+        const std::vector<std::vector<Chirotope<R, N>>>& OMs_by_basecount,
+        unsigned nr_threads = parallel::default_number_of_threads()
+    );
+
+    // Returns the number of elements.
+    size_t size() const
+    { return elements.size(); }
+    // Returns the number of bases of the element with the given index.
+    int basecount(size_t idx) const;
+    // Returns whether the comparabilities were stored.
+    bool has_comparabilities() const
+    { return smaller.size() == elements.size(); }
+    // Returns whether the element with index `lower` is strictly
+    // below the element with index `upper` (using `smaller`).
+    bool is_strictly_below(size_t lower, size_t upper) const;
+
+    // ===============
+    // MOBIUS FUNCTION
+    // ===============
+
+    // Returns `mu(0, x)` for every element `x` of the poset, where `mu`
+    // is the Mobius function of the poset with a new minimum `0`
+    // adjoined: `mu(0, 0) = 1`, and `mu(0, x) = -sum mu(0, y)`, where
+    // `y` runs over `0` and the elements strictly below `x`. These are
+    // computed by the constructor, so this works without `smaller`.
+    //
+    // By Hall's theorem, `mu(0, x)` is the reduced Euler characteristic
+    // of the order complex of the strict lower cone of `x`; add 1 to
+    // get the Euler characteristic returned by `euler_characteristic`.
+    const std::vector<long long>& mobius_from_bottom() const
+    { return mu_from_bottom; }
+    // Computes the Mobius function `mu(lower, upper)` of the poset
+    // itself (without an adjoined minimum), using only the elements
+    // of the closed interval between the given elements (found with
+    // `smaller`). Returns 0
+    // if `lower` is not below `upper`.
+    long long mobius(size_t lower, size_t upper) const;
+
+    // =================
+    // CONE FACE VECTORS
+    // =================
+
+    // Computes, for every element, the face vector of the order complex
+    // of its strict lower cone (see `face_vector` in `ordercomplexes.hpp`
+    // for the meaning of `dim_bound`). The levels are swept in increasing
+    // order of basecount, and the elements of each level are distributed
+    // over `nr_threads` threads. The elements below each element are
+    // taken from `smaller` if the comparabilities are stored, and are
+    // found by comparing it to the lower levels otherwise.
+    template<int dim_bound>
+    std::vector<std::array<size_t, dim_bound>> lower_cone_face_vectors(
+        unsigned nr_threads = parallel::default_number_of_threads()
+    ) const;
+    // Computes, for every element, the face vector of the order complex
+    // of its strict upper cone. The levels are swept in decreasing order
+    // of basecount: once the face vectors of a level are final, each
+    // element `y` of the level adds its share (`1` chain `{y}`, and the
+    // chains of its upper cone extended by `y`) to the elements below
+    // it, which are taken from `smaller[y]` if the comparabilities are
+    // stored, and are found by comparing `y` to the lower levels
+    // otherwise. The elements receiving these are split into ranges,
+    // which are distributed over `nr_threads` threads, so no list of
+    // elements above is ever stored.
+    template<int dim_bound>
+    std::vector<std::array<size_t, dim_bound>> upper_cone_face_vectors(
+        unsigned nr_threads = parallel::default_number_of_threads()
+    ) const;
+
+    // ======
+    // CHAINS
+    // ======
+
+    // A chain has at most one element of each basecount, so its
+    // length is at most `NR`.
+    constexpr static const int MAX_CHAIN_LENGTH = NR;
+
+    // Calls `callback(chain)` for every chain of the poset whose
+    // largest element is `top`, where `chain` is a
+    // `std::span<const uint32_t>` listing the indices of the elements
+    // of the chain in decreasing order (so `chain[0] == top`). The
+    // span is only valid during the call.
+    //
+    // The chains are produced by a depth-first search which descends
+    // from each element of the chain to all elements below it (only
+    // covers would miss the chains which skip a level), and chains are
+    // never collected in memory. If the comparabilities are stored, the
+    // search descends along `smaller`, and only a stack of
+    // `MAX_CHAIN_LENGTH` ids is stored. Otherwise the elements below
+    // `top` are found by comparing it to the lower levels, and those
+    // below each further element of the chain by comparing it to the
+    // elements found below the previous one. Then the stack holds one
+    // such list per element of the chain, each at most as long as the
+    // lower cone of `top`, which fits large posets like `MacP(3,7)` at
+    // the cost of repeating these comparisons for every chain.
+    template<typename Callback>
+    void for_each_chain_with_top(size_t top, Callback&& callback) const;
+    // Calls `callback(thread_idx, chain)` for every nonempty chain of
+    // the poset, as in `for_each_chain_with_top`. The chains are
+    // partitioned by their largest element, and these parts are
+    // distributed over `nr_threads` threads; `thread_idx` is the index
+    // of the calling thread (see `parallel::for_each_index_on_thread`),
+    // which can be used to address per-thread accumulators.
+    template<typename Callback>
+    void for_each_chain(
+        Callback&& callback,
+        unsigned nr_threads = parallel::default_number_of_threads()
+    ) const;
+    // Counts the chains of the poset by dimension: the `d`th entry is
+    // the number of chains with `d+1` elements, so the result is the
+    // face vector of the order complex of the poset. Uses one counter
+    // array per thread.
+    std::array<size_t, MAX_CHAIN_LENGTH> count_chains(
+        unsigned nr_threads = parallel::default_number_of_threads()
+    ) const;
+
+private:
+    OMPoset(
+        const std::vector<std::vector<Chirotope<R, N>>>& OMs_by_basecount,
+        unsigned nr_threads,
+        bool store_comparabilities
+    );
+};
+
+// This file declares templates, so their implementations must
+// be in this same header file as well.
+#include "posets_impl.hpp"
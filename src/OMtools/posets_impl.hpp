@@ -0,0 +1,239 @@
+#pragma once
+
+#include <algorithm>
+#include <vector>
+#include "posets.hpp"
+
+template<int R, int N>
+OMPoset<R, N>::OMPoset(): level_start(NR + 2, 0) {}
+
+template<int R, int N>
+OMPoset<R, N>::OMPoset(
+    const std::vector<std::vector<Chirotope<R, N>>>& OMs_by_basecount,
+    unsigned nr_threads
+): OMPoset(OMs_by_basecount, nr_threads, false) {}
+
+template<int R, int N>
+OMPoset<R, N> OMPoset<R, N>::with_comparabilities(
+    const std::vector<std::vector<Chirotope<R, N>>>& OMs_by_basecount,
+    unsigned nr_threads
+) {
+    return OMPoset(OMs_by_basecount, nr_threads, true);
+}
+
+template<int R, int N>
+OMPoset<R, N>::OMPoset(
+    const std::vector<std::vector<Chirotope<R, N>>>& OMs_by_basecount,
+    unsigned nr_threads,
+    bool store_comparabilities
+): level_start(NR + 2, 0) {
+    for (int b = 1; b <= NR; ++b) {
+        level_start[b] = elements.size();
+        if (b - 1 < (int)OMs_by_basecount.size()) {
+            for (const auto& chi : OMs_by_basecount[b - 1]) elements.push_back(chi);
+        }
+    }
+    level_start[NR + 1] = elements.size();
+    mu_from_bottom.assign(elements.size(), 0);
+    if (store_comparabilities) smaller.assign(elements.size(), std::vector<uint32_t>());
+    // The values of `mu` on the lower levels are final when a level is
+    // compared to them, so they can be summed up right away.
+    for (int b = 1; b <= NR; ++b) {
+        parallel::for_each_index(level_start[b], level_start[b + 1], [&](size_t x) {
+            long long sum = 1;
+            for (uint32_t y = 0; y < level_start[b]; ++y) {
+                if (!elements[x].OM_weak_maps_to(elements[y])) continue;
+                sum += mu_from_bottom[y];
+                if (store_comparabilities) smaller[x].push_back(y);
+            }
+            mu_from_bottom[x] = -sum;
+        }, nr_threads, 64);
+    }
+}
+
+template<int R, int N>
+int OMPoset<R, N>::basecount(size_t idx) const {
+    return std::upper_bound(level_start.begin(), level_start.end(), idx)
+        - level_start.begin() - 1;
+}
+
+template<int R, int N>
+bool OMPoset<R, N>::is_strictly_below(size_t lower, size_t upper) const {
+    return std::binary_search(smaller[upper].begin(), smaller[upper].end(), lower);
+}
+
+// ===============
+// MOBIUS FUNCTION
+// ===============
+
+template<int R, int N>
+long long OMPoset<R, N>::mobius(size_t lower, size_t upper) const {
+    if (lower == upper) return 1;
+    if (!is_strictly_below(lower, upper)) return 0;
+    // The elements of the interval, in increasing order.
+    std::vector<uint32_t> interval{(uint32_t)lower};
+    for (auto w : smaller[upper]) {
+        if (is_strictly_below(lower, w)) interval.push_back(w);
+    }
+    interval.push_back(upper);
+    std::vector<long long> mu(interval.size(), 0);
+    mu[0] = 1;
+    for (size_t i = 1; i < interval.size(); ++i) {
+        long long sum = 0;
+        for (size_t j = 0; j < i; ++j) {
+            if (j == 0 || is_strictly_below(interval[j], interval[i])) sum += mu[j];
+        }
+        mu[i] = -sum;
+    }
+    return mu.back();
+}
+
+// =================
+// CONE FACE VECTORS
+// =================
+
+template<int R, int N>
+template<int dim_bound>
+std::vector<std::array<size_t, dim_bound>> OMPoset<R, N>::lower_cone_face_vectors(
+    unsigned nr_threads
+) const {
+    std::vector<std::array<size_t, dim_bound>> face_vectors(elements.size());
+    for (int b = 1; b <= NR; ++b) {
+        parallel::for_each_index(level_start[b], level_start[b + 1], [&](size_t x) {
+            if (has_comparabilities()) {
+                face_vectors[x] = face_vector<dim_bound>(face_vectors, smaller[x]);
+                return;
+            }
+            auto& f = face_vectors[x];
+            f.fill(0);
+            for (uint32_t y = 0; y < level_start[b]; ++y) {
+                if (!elements[x].OM_weak_maps_to(elements[y])) continue;
+                f[0] += 1;
+                for (int d = 0; d < dim_bound - 1; ++d) f[d + 1] += face_vectors[y][d];
+            }
+        }, nr_threads, 64);
+    }
+    return face_vectors;
+}
+
+template<int R, int N>
+template<int dim_bound>
+std::vector<std::array<size_t, dim_bound>> OMPoset<R, N>::upper_cone_face_vectors(
+    unsigned nr_threads
+) const {
+    std::vector<std::array<size_t, dim_bound>> face_vectors(elements.size());
+    for (auto& f : face_vectors) f.fill(0);
+    const size_t nr_ranges = 4 * parallel::effective_number_of_threads(nr_threads);
+    for (int b = NR; b >= 1; --b) {
+        // The face vectors of the elements of level `b` are final, and
+        // are added to those of the elements below them, which all have
+        // indices less than `level_start[b]`.
+        const size_t end_of_lower_levels = level_start[b];
+        if (end_of_lower_levels == 0) break;
+        const size_t range_size = (end_of_lower_levels + nr_ranges - 1) / nr_ranges;
+        parallel::for_each_index(0, nr_ranges, [&](size_t range) {
+            const uint32_t from = range * range_size;
+            const uint32_t to = std::min(end_of_lower_levels, (range + 1) * range_size);
+            if (from >= to) return;
+            auto add_share = [&](uint32_t y, uint32_t x) {
+                face_vectors[x][0] += 1;
+                for (int d = 0; d < dim_bound - 1; ++d) {
+                    face_vectors[x][d + 1] += face_vectors[y][d];
+                }
+            };
+            for (uint32_t y = level_start[b]; y < level_start[b + 1]; ++y) {
+                if (!has_comparabilities()) {
+                    for (uint32_t x = from; x < to; ++x) {
+                        if (elements[y].OM_weak_maps_to(elements[x])) add_share(y, x);
+                    }
+                    continue;
+                }
+                auto x = std::lower_bound(smaller[y].begin(), smaller[y].end(), from);
+                for (; x != smaller[y].end() && *x < to; ++x) add_share(y, *x);
+            }
+        }, nr_threads);
+    }
+    return face_vectors;
+}
+
+// ======
+// CHAINS
+// ======
+
+template<int R, int N>
+template<typename Callback>
+void OMPoset<R, N>::for_each_chain_with_top(size_t top, Callback&& callback) const {
+    std::array<uint32_t, MAX_CHAIN_LENGTH> chain;
+    // `below[k]` is the increasing list of indices of the elements
+    // strictly below `chain[k]`: either `smaller[chain[k]]`, or
+    // `found_below[k]` if the comparabilities are not stored.
+    std::array<std::span<const uint32_t>, MAX_CHAIN_LENGTH> below;
+    std::vector<std::vector<uint32_t>> found_below(has_comparabilities() ? 0 : MAX_CHAIN_LENGTH);
+    // `next_below[k]` is the position in `below[k]` of the next element
+    // to try as `chain[k+1]`.
+    std::array<uint32_t, MAX_CHAIN_LENGTH> next_below;
+    auto push = [&](int k, uint32_t x) {
+        chain[k] = x;
+        next_below[k] = 0;
+        if (has_comparabilities()) {
+            below[k] = smaller[x];
+            return;
+        }
+        // The elements below `x` are below `chain[k-1]` as well, and
+        // have smaller basecounts.
+        auto& found = found_below[k];
+        found.clear();
+        const uint32_t end_of_lower_levels = level_start[basecount(x)];
+        if (k == 0) {
+            for (uint32_t y = 0; y < end_of_lower_levels; ++y) {
+                if (elements[x].OM_weak_maps_to(elements[y])) found.push_back(y);
+            }
+        } else {
+            for (uint32_t y : below[k - 1]) {
+                if (y >= end_of_lower_levels) break;
+                if (elements[x].OM_weak_maps_to(elements[y])) found.push_back(y);
+            }
+        }
+        below[k] = found;
+    };
+    int length = 1;
+    push(0, top);
+    callback(std::span<const uint32_t>(chain.data(), length));
+    while (length > 0) {
+        if (length < MAX_CHAIN_LENGTH && next_below[length - 1] < below[length - 1].size()) {
+            push(length, below[length - 1][next_below[length - 1]++]);
+            ++length;
+            callback(std::span<const uint32_t>(chain.data(), length));
+        } else {
+            --length;
+        }
+    }
+}
+
+template<int R, int N>
+template<typename Callback>
+void OMPoset<R, N>::for_each_chain(Callback&& callback, unsigned nr_threads) const {
+    parallel::for_each_index_on_thread(0, elements.size(), [&](unsigned thread_idx, size_t top) {
+        for_each_chain_with_top(top, [&](std::span<const uint32_t> chain) {
+            callback(thread_idx, chain);
+        });
+    }, nr_threads);
+}
+
+template<int R, int N>
+std::array<size_t, OMPoset<R, N>::MAX_CHAIN_LENGTH> OMPoset<R, N>::count_chains(
+    unsigned nr_threads
+) const {
+    std::vector<std::array<size_t, MAX_CHAIN_LENGTH>> counts_per_thread(
+        parallel::effective_number_of_threads(nr_threads)
+    );
+    for (auto& counts : counts_per_thread) counts.fill(0);
+    for_each_chain([&](unsigned thread_idx, std::span<const uint32_t> chain) {
+        ++counts_per_thread[thread_idx][chain.size() - 1];
+    }, nr_threads);
+    std::array<size_t, MAX_CHAIN_LENGTH> counts; counts.fill(0);
+    for (const auto& counts_of_thread : counts_per_thread) {
+        for (int d = 0; d < MAX_CHAIN_LENGTH; ++d) counts[d] += counts_of_thread[d];
+    }
+    return counts;
+}
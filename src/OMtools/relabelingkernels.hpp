@@ -0,0 +1,70 @@
+#pragma once
+
+#include <array>
+#include <vector>
+#include "OMs.hpp"
+#include "OMoperations.hpp"
+#include "signvectoroperations.hpp"
+#include "parallel.hpp"
+
+namespace OM_operations {
+
+// ==================
+// RELABELING KERNELS
+// ==================
+
+// The relabeling of rank `R` chirotopes on `N` elements by a permutation
+// (see `relabel_elements`), compiled for applying it to many chirotopes:
+// the signs of sorting the relabeled `R`-tuples are applied first, and
+// then the induced permutation of the `R`-tuples is applied using a
+// `gather_table`, which looks up the image of each byte of `plus` and
+// `minus` in a table. For `(R, N) = (4, 9)` the table takes 64 KiB.
+template<int R, int N>
+struct RelabelingKernel {
+    // The permutation: element `e` gets label `permutation[e]`.
+    std::array<int, N> permutation;
+    svo::Multiply<Chirotope<R, N>> signs;
+    svo::CompiledPushForward<Chirotope<R, N>, Chirotope<R, N>> push_forward;
+
+    // Compiles the relabeling by the given permutation.
+    RelabelingKernel(const std::array<int, N>& permutation);
+
+    // Returns the relabeled chirotope, equal to the one returned by
+    // `relabel_elements<R, N>(permutation)`.
+    Chirotope<R, N> applied(const Chirotope<R, N>& chi) const
+    { return push_forward(signs(chi)); }
+    Chirotope<R, N> operator()(const Chirotope<R, N>& chi) const
+    { return applied(chi); }
+};
+
+// Returns the kernel of the relabeling by the given permutation,
+// compiling it on the first request for this permutation. Kernels are
+// kept for the lifetime of the program in a table shared by all
+// threads and protected by a mutex, so this is safe to call from
+// several threads, and the returned reference stays valid. Kernels of
+// permutations used only once should rather be constructed directly.
+template<int R, int N>
+const RelabelingKernel<R, N>& relabeling_kernel(const std::array<int, N>& permutation);
+
+// Relabels every chirotope of `chis` using the given kernel. The
+// chirotopes are distributed over `nr_threads` threads.
+template<int R, int N>
+void apply_to_all(
+    const RelabelingKernel<R, N>& kernel,
+    ChirotopeArray<R, N>& chis,
+    unsigned nr_threads = parallel::default_number_of_threads()
+);
+// Relabels every chirotope of `chis` by the given permutation, using
+// the cached kernel returned by `relabeling_kernel`.
+template<int R, int N>
+void apply_to_all(
+    const std::array<int, N>& permutation,
+    ChirotopeArray<R, N>& chis,
+    unsigned nr_threads = parallel::default_number_of_threads()
+);
+
+}
+
+// This file declares templates, so their implementations must
+// be in this same header file as well.
+#include "relabelingkernels_impl.hpp"
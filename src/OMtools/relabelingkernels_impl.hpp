@@ -0,0 +1,51 @@
+#pragma once
+
+#include <map>
+#include <mutex>
+#include "relabelingkernels.hpp"
+
+namespace OM_operations {
+
+// ==================
+// RELABELING KERNELS
+// ==================
+
+template<int R, int N>
+RelabelingKernel<R, N>::RelabelingKernel(const std::array<int, N>& permutation):
+permutation(permutation) {
+    auto relabeling = relabel_elements<R, N>(permutation);
+    signs = relabeling.op01;
+    push_forward = relabeling.op12;
+}
+
+template<int R, int N>
+const RelabelingKernel<R, N>& relabeling_kernel(const std::array<int, N>& permutation) {
+    static std::mutex mutex;
+    static std::map<std::array<int, N>, RelabelingKernel<R, N>> kernels;
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = kernels.find(permutation);
+    if (it == kernels.end()) it = kernels.emplace(permutation, RelabelingKernel<R, N>(permutation)).first;
+    return it->second;
+}
+
+template<int R, int N>
+void apply_to_all(
+    const RelabelingKernel<R, N>& kernel,
+    ChirotopeArray<R, N>& chis,
+    unsigned nr_threads
+) {
+    parallel::for_each_index(0, chis.size(), [&](size_t idx) {
+        chis[idx] = kernel(chis[idx]);
+    }, nr_threads, 1024);
+}
+
+template<int R, int N>
+void apply_to_all(
+    const std::array<int, N>& permutation,
+    ChirotopeArray<R, N>& chis,
+    unsigned nr_threads
+) {
+    apply_to_all(relabeling_kernel<R, N>(permutation), chis, nr_threads);
+}
+
+}
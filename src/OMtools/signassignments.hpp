@@ -0,0 +1,112 @@
+#pragma once
+
+#include <cstdint>
+#include <array>
+#include <vector>
+#include "mymath.hpp"
+#include "OMs.hpp"
+#include "parallel.hpp"
+
+// A three-term Grassmann-Plucker relation of rank `R` chirotopes on
+// `N` elements: for an `(R-2)`-tuple `X` and distinct `a<b<c<d` not
+// in `X`, the three terms
+//   `chi(X,a,b)*chi(X,c,d)`, `-chi(X,a,c)*chi(X,b,d)`, `chi(X,a,d)*chi(X,b,c)`
+// are either all zero, or at least one of them is positive and at least
+// one of them is negative. Here the `t`th term is
+// `signs[t] * chi[bases[2*t]] * chi[bases[2*t+1]]`, where `bases`
+// are indices into `Chirotope<R,N>::RTUPLES::LIST::array`, and the
+// signs of sorting the `R`-tuples are included in `signs`.
+struct ThreeTermGPRelation {
+    std::array<int, 6> bases;
+    std::array<int, 3> signs;
+};
+
+// Returns the list of all three-term Grassmann-Plucker relations of
+// rank `R` chirotopes on `N` elements. The list is computed on the
+// first call.
+template<int R, int N>
+const std::vector<ThreeTermGPRelation>& three_term_GP_relations();
+
+// Enumerates chirotopes of rank `R` on `N` elements whose values are
+// prescribed on some `R`-tuples, and are unknown on the others.
+//
+// Every `R`-tuple (called basis below, and referred to by its index
+// in `Chirotope<R,N>::RTUPLES::LIST::array`) is either fixed to a
+// value, or tied to a variable: it then evaluates to the value of the
+// variable, or to its opposite. Several bases may be tied to the same
+// variable, and each variable has a domain of allowed values. Initially
+// all bases are fixed to `0`, and there are no variables.
+//
+// The search assigns the variables in increasing order. After each
+// assignment, the three-term Grassmann-Plucker relations in which only
+// one basis is still unknown are used to force the value of its variable,
+// and relations without unknown bases are checked; this prunes most
+// branches which cannot lead to chirotopes. Every complete assignment
+// is finally checked with `Chirotope<R,N>::is_chirotope()`.
+template<int R, int N>
+class SignAssignmentSearch {
+public:
+    // The number of `R`-tuples.
+    constexpr static const int NR = binomial_coefficient(N, R);
+    // The possible values of a variable, used as bits of its domain.
+    constexpr static const uint8_t ZERO = 1;
+    constexpr static const uint8_t PLUS = 2;
+    constexpr static const uint8_t MINUS = 4;
+    constexpr static const uint8_t ANY = ZERO | PLUS | MINUS;
+
+    // If `true`, then only one of every chirotope and its inverse is
+    // produced: the one whose first nonzero variable is `+`. This only
+    // makes sense if no basis is fixed to a nonzero value.
+    bool identify_inverses = false;
+
+    // Creates a search in which every basis is fixed to `0`.
+    SignAssignmentSearch();
+
+    // Fixes the value of the given basis to `'0'`, `'+'`, or `'-'`.
+    SignAssignmentSearch& fix(int basis, char value);
+    // Adds a new variable with the given domain, and returns its index.
+    int add_variable(uint8_t domain = ANY);
+    // Ties the given basis to the given variable: it will evaluate to
+    // the value of the variable if `opposite == false`, and to its
+    // opposite otherwise.
+    SignAssignmentSearch& tie(int basis, int variable, bool opposite = false);
+    // Returns the number of variables.
+    int number_of_variables() const
+    { return domains.size(); }
+
+    // Calls `callback(thread_idx, chi)` for every chirotope `chi`
+    // compatible with the prescribed values and domains, where
+    // `thread_idx` is as in `parallel::for_each_index_on_thread`.
+    //
+    // The search tree is split after the first few branchings, and its
+    // subtrees are distributed over `nr_threads` threads; `callback`
+    // must therefore be safe to call concurrently from several threads.
+    template<typename Callback>
+    void for_each_chirotope(
+        Callback&& callback,
+        unsigned nr_threads = parallel::default_number_of_threads()
+    ) const;
+    // Returns all chirotopes found by `for_each_chirotope`, grouped by
+    // basecount, where the index is shifted by 1 from the actual
+    // basecount. The order of the output does not depend on the number
+    // of threads.
+    std::vector<std::vector<Chirotope<R, N>>> chirotopes_by_basecount(
+        unsigned nr_threads = parallel::default_number_of_threads()
+    ) const;
+
+private:
+    // `variable_of[b]` is the variable basis `b` is tied to, or `-1`
+    // if its value is fixed.
+    std::array<int, NR> variable_of;
+    // The fixed value (`-1`, `0`, or `1`) of basis `b` if it is not
+    // tied to a variable, and otherwise `-1` if it evaluates to the
+    // opposite of its variable, and `1` if not.
+    std::array<int, NR> value_or_multiplier;
+    std::vector<uint8_t> domains;
+
+    class Solver;
+};
+
+// This file declares templates, so their implementations must
+// be in this same header file as well.
+#include "signassignments_impl.hpp"
@@ -0,0 +1,327 @@
+#pragma once
+
+#include <algorithm>
+#include <mutex>
+#include <utility>
+#include <vector>
+#include "signassignments.hpp"
+
+template<int R, int N>
+const std::vector<ThreeTermGPRelation>& three_term_GP_relations() {
+    static const std::vector<ThreeTermGPRelation> relations = []() {
+        using RTUPLES = typename Chirotope<R, N>::RTUPLES;
+        std::vector<ThreeTermGPRelation> list;
+        if constexpr (R >= 2 && N >= R + 2) {
+            // The terms are `chi(X,a,b)chi(X,c,d)`, `-chi(X,a,c)chi(X,b,d)`,
+            // and `chi(X,a,d)chi(X,b,c)`, where `abcd` is the 4-tuple below.
+            constexpr int pairs[3][4] = {{0, 1, 2, 3}, {0, 2, 1, 3}, {0, 3, 1, 2}};
+            constexpr int coefficients[3] = {1, -1, 1};
+            for (int x = 0; x < (int)binomial_coefficient(N, R - 2); ++x) {
+                std::array<char, R - 2> X{};
+                if constexpr (R > 2) X = Rtuples::RTUPLES<char, R - 2, N, int>::LIST::array[x];
+                std::array<bool, N> in_X{};
+                for (auto e : X) in_X[e] = true;
+                std::array<char, N> rest{};
+                int nr_rest = 0;
+                for (char e = 0; e < N; ++e) if (!in_X[e]) rest[nr_rest++] = e;
+                for (int i0 = 0; i0 < nr_rest; ++i0)
+                for (int i1 = i0 + 1; i1 < nr_rest; ++i1)
+                for (int i2 = i1 + 1; i2 < nr_rest; ++i2)
+                for (int i3 = i2 + 1; i3 < nr_rest; ++i3) {
+                    char abcd[4] = {rest[i0], rest[i1], rest[i2], rest[i3]};
+                    ThreeTermGPRelation relation;
+                    for (int t = 0; t < 3; ++t) {
+                        int sign = coefficients[t];
+                        for (int f = 0; f < 2; ++f) {
+                            std::array<char, R> Rtuple;
+                            for (int k = 0; k < R - 2; ++k) Rtuple[k] = X[k];
+                            Rtuple[R - 2] = abcd[pairs[t][2 * f]];
+                            Rtuple[R - 1] = abcd[pairs[t][2 * f + 1]];
+                            auto sign_and_index = RTUPLES::sign_and_index_of_unordered(Rtuple);
+                            sign *= sign_and_index.first;
+                            relation.bases[2 * t + f] = sign_and_index.second;
+                        }
+                        relation.signs[t] = sign;
+                    }
+                    list.push_back(relation);
+                }
+            }
+        }
+        return list;
+    }();
+    return relations;
+}
+
+// ======
+// SOLVER
+// ======
+
+// Holds the state of one branch of the search: the current domains of
+// the variables, and a trail of the changes made to them, so that they
+// can be undone when backtracking.
+template<int R, int N>
+class SignAssignmentSearch<R, N>::Solver {
+public:
+    const SignAssignmentSearch& search;
+    // `relations_of[v]` lists the relations involving a basis tied to `v`.
+    const std::vector<std::vector<int>>& relations_of;
+    bool fixed_nonzero_basis;
+    std::vector<uint8_t> domains;
+    std::vector<std::pair<int, uint8_t>> trail;
+    std::vector<int> queue;
+
+    Solver(
+        const SignAssignmentSearch& search_,
+        const std::vector<std::vector<int>>& relations_of_,
+        bool fixed_nonzero_basis_,
+        const std::vector<uint8_t>& domains_
+    ): search(search_), relations_of(relations_of_),
+    fixed_nonzero_basis(fixed_nonzero_basis_), domains(domains_) {}
+
+    static bool is_singleton(uint8_t domain)
+    { return domain == ZERO || domain == PLUS || domain == MINUS; }
+    static int value_of_singleton(uint8_t domain)
+    { return domain == PLUS ? 1 : (domain == MINUS ? -1 : 0); }
+    static uint8_t singleton_of_value(int value)
+    { return value > 0 ? PLUS : (value < 0 ? MINUS : ZERO); }
+
+    // Returns whether the value of the given basis is already known,
+    // and if so, writes it to `value`.
+    bool known_value(int basis, int& value) const {
+        int variable = search.variable_of[basis];
+        if (variable < 0) {
+            value = search.value_or_multiplier[basis];
+            return true;
+        }
+        if (!is_singleton(domains[variable])) return false;
+        value = search.value_or_multiplier[basis] * value_of_singleton(domains[variable]);
+        return true;
+    }
+
+    // Intersects the domain of the variable with the given one. Returns
+    // `false` if the domain becomes empty.
+    bool restrict(int variable, uint8_t domain) {
+        uint8_t restricted = domains[variable] & domain;
+        if (restricted == domains[variable]) return true;
+        if (restricted == 0) return false;
+        trail.push_back({variable, domains[variable]});
+        domains[variable] = restricted;
+        if (is_singleton(restricted)) queue.push_back(variable);
+        return true;
+    }
+
+    // Checks the relation if all of its bases are known, and forces the
+    // value of the remaining basis if exactly one of them is unknown.
+    // Returns `false` if the relation cannot be satisfied.
+    bool check(const ThreeTermGPRelation& relation) {
+        int values[6];
+        int unknown = -1;
+        for (int k = 0; k < 6; ++k) {
+            if (known_value(relation.bases[k], values[k])) continue;
+            if (unknown >= 0) return true;
+            unknown = k;
+        }
+        bool has_plus = false, has_minus = false;
+        for (int t = 0; t < 3; ++t) {
+            if (unknown >= 0 && unknown / 2 == t) continue;
+            int term = relation.signs[t] * values[2 * t] * values[2 * t + 1];
+            has_plus |= (term > 0);
+            has_minus |= (term < 0);
+        }
+        if (unknown < 0) return has_plus == has_minus;
+        if (has_plus && has_minus) return true;
+        int coefficient = relation.signs[unknown / 2] * values[unknown ^ 1];
+        int required;
+        if (!has_plus && !has_minus) {
+            // The remaining term must vanish.
+            if (coefficient == 0) return true;
+            required = 0;
+        } else {
+            // The remaining term must have the opposite sign.
+            if (coefficient == 0) return false;
+            required = (has_plus ? -1 : 1) * coefficient;
+        }
+        int basis = relation.bases[unknown];
+        return restrict(
+            search.variable_of[basis],
+            singleton_of_value(required * search.value_or_multiplier[basis])
+        );
+    }
+
+    // Checks the relations of all variables in the queue. Returns
+    // `false` if one of them cannot be satisfied.
+    bool propagate() {
+        const auto& relations = three_term_GP_relations<R, N>();
+        while (!queue.empty()) {
+            int variable = queue.back();
+            queue.pop_back();
+            for (int rel : relations_of[variable]) {
+                if (!check(relations[rel])) {
+                    queue.clear();
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    void undo(size_t trail_size) {
+        while (trail.size() > trail_size) {
+            domains[trail.back().first] = trail.back().second;
+            trail.pop_back();
+        }
+    }
+
+    // Returns whether some basis is already known to be nonzero.
+    bool knows_nonzero_basis() const {
+        if (fixed_nonzero_basis) return true;
+        for (auto domain : domains) {
+            if (domain == PLUS || domain == MINUS) return true;
+        }
+        return false;
+    }
+
+    // Returns the chirotope defined by the current (complete) assignment.
+    Chirotope<R, N> chirotope() const {
+        Chirotope<R, N> chi;
+        for (int b = 0; b < NR; ++b) {
+            int value;
+            known_value(b, value);
+            if (value > 0) chi.set_plus(b, true);
+            else if (value < 0) chi.set_minus(b, true);
+        }
+        return chi;
+    }
+
+    // Assigns the variables from `variable` onwards in every possible
+    // way, and calls `visit(*this, next_variable)` for each resulting
+    // state. At most `branchings` branchings are made: if the limit is
+    // reached, `next_variable` is the first unassigned variable,
+    // otherwise it is the number of variables.
+    template<typename Visit>
+    void descend(int variable, int branchings, Visit& visit) {
+        int nr_variables = domains.size();
+        while (variable < nr_variables && is_singleton(domains[variable])) ++variable;
+        if (variable == nr_variables || branchings == 0) {
+            visit(*this, variable);
+            return;
+        }
+        uint8_t domain = domains[variable];
+        if (search.identify_inverses && !knows_nonzero_basis()) domain &= (ZERO | PLUS);
+        for (uint8_t value : {ZERO, PLUS, MINUS}) {
+            if (!(domain & value)) continue;
+            size_t trail_size = trail.size();
+            if (restrict(variable, value) && propagate()) {
+                descend(variable + 1, branchings - 1, visit);
+            }
+            queue.clear();
+            undo(trail_size);
+        }
+    }
+};
+
+template<int R, int N>
+SignAssignmentSearch<R, N>::SignAssignmentSearch() {
+    variable_of.fill(-1);
+    value_or_multiplier.fill(0);
+}
+
+template<int R, int N>
+SignAssignmentSearch<R, N>& SignAssignmentSearch<R, N>::fix(int basis, char value) {
+    variable_of[basis] = -1;
+    value_or_multiplier[basis] = (value == '+') ? 1 : (value == '-' ? -1 : 0);
+    return *this;
+}
+
+template<int R, int N>
+int SignAssignmentSearch<R, N>::add_variable(uint8_t domain) {
+    domains.push_back(domain);
+    return domains.size() - 1;
+}
+
+template<int R, int N>
+SignAssignmentSearch<R, N>& SignAssignmentSearch<R, N>::tie(int basis, int variable, bool opposite) {
+    variable_of[basis] = variable;
+    value_or_multiplier[basis] = opposite ? -1 : 1;
+    return *this;
+}
+
+template<int R, int N>
+template<typename Callback>
+void SignAssignmentSearch<R, N>::for_each_chirotope(Callback&& callback, unsigned nr_threads) const {
+    const auto& relations = three_term_GP_relations<R, N>();
+    std::vector<std::vector<int>> relations_of(domains.size());
+    for (int rel = 0; rel < (int)relations.size(); ++rel) {
+        for (int b : relations[rel].bases) {
+            int variable = variable_of[b];
+            if (variable < 0) continue;
+            if (relations_of[variable].empty() || relations_of[variable].back() != rel) {
+                relations_of[variable].push_back(rel);
+            }
+        }
+    }
+    bool fixed_nonzero_basis = false;
+    for (int b = 0; b < NR; ++b) {
+        if (variable_of[b] < 0 && value_or_multiplier[b] != 0) fixed_nonzero_basis = true;
+    }
+
+    // Check the relations once, which also propagates the fixed values.
+    Solver root(*this, relations_of, fixed_nonzero_basis, domains);
+    for (int v = 0; v < (int)domains.size(); ++v) {
+        if (domains[v] == 0) return;
+        if (Solver::is_singleton(domains[v])) root.queue.push_back(v);
+    }
+    for (const auto& relation : relations) {
+        if (!root.check(relation)) return;
+    }
+    if (!root.propagate()) return;
+
+    // Split the search tree into subtrees for the threads.
+    nr_threads = parallel::effective_number_of_threads(nr_threads);
+    int branchings = 0;
+    for (size_t subtrees = 1; subtrees < 16 * (size_t)nr_threads; subtrees *= 3) ++branchings;
+    if (nr_threads == 1) branchings = 0;
+    std::vector<std::pair<std::vector<uint8_t>, int>> subtrees;
+    auto collect = [&subtrees](Solver& solver, int next_variable) {
+        subtrees.push_back({solver.domains, next_variable});
+    };
+    root.descend(0, branchings, collect);
+
+    parallel::for_each_index_on_thread(0, subtrees.size(), [&](unsigned thread_idx, size_t idx) {
+        Solver solver(*this, relations_of, fixed_nonzero_basis, subtrees[idx].first);
+        auto visit_leaf = [&](Solver& leaf, int) {
+            if (identify_inverses) {
+                for (auto domain : leaf.domains) {
+                    if (domain == MINUS) return;
+                    if (domain == PLUS) break;
+                }
+            }
+            auto chi = leaf.chirotope();
+            if (chi.is_chirotope()) callback(thread_idx, chi);
+        };
+        solver.descend(subtrees[idx].second, -1, visit_leaf);
+    }, nr_threads);
+}
+
+template<int R, int N>
+std::vector<std::vector<Chirotope<R, N>>> SignAssignmentSearch<R, N>::chirotopes_by_basecount(
+    unsigned nr_threads
+) const {
+    std::vector<std::vector<Chirotope<R, N>>> by_basecount(NR);
+    std::mutex mutex;
+    for_each_chirotope([&](unsigned, const Chirotope<R, N>& chi) {
+        std::lock_guard<std::mutex> lock(mutex);
+        by_basecount[chi.countbases() - 1].push_back(chi);
+    }, nr_threads);
+    // Make the order independent of the scheduling of the threads.
+    for (auto& chirotopes : by_basecount) {
+        std::sort(chirotopes.begin(), chirotopes.end(), [](const auto& chi1, const auto& chi2) {
+            for (int i = 0; i < Chirotope<R, N>::BASE::NR_INT32; ++i) {
+                if (chi1.plus.bits[i] != chi2.plus.bits[i]) return chi1.plus.bits[i] < chi2.plus.bits[i];
+                if (chi1.minus.bits[i] != chi2.minus.bits[i]) return chi1.minus.bits[i] < chi2.minus.bits[i];
+            }
+            return false;
+        });
+    }
+    return by_basecount;
+}
@@ -3,6 +3,7 @@
 #include <cstdint>
 #include <concepts>
 #include <array>
+#include <vector>
 #include "mymath.hpp"
 #include "signvectors.hpp"
 
@@ -120,6 +121,43 @@ sign_vector<L0> pull_back(
     const index_function<L0,L1>&, const sign_vector<L1>&
 );
 
+// ================
+//   gather_table
+// ================
+
+// A compiled form of an injective `index_function`, for pushing
+// forward many vectors along the same function: the push forward of
+// every possible value of every byte of the input is precomputed,
+// so a push forward only takes a lookup and an OR of `L1/32` integers
+// for each byte of the input. This uses `256 * L0/8 * L1/32` integers.
+template<int L0, int L1>
+struct gather_table {
+    // The number of bytes needed to store `L0` bits.
+    constexpr static const int NR_BYTES = division_rounded_up(L0, 8);
+
+    // `images[256 * k + v]` is the push forward of the bitvector whose
+    // `k`th byte is `v`, and whose other bytes are 0.
+    std::vector<bit_vector<L1>> images;
+
+    // Initializes the table of the constant 0 function.
+    gather_table() {}
+    // Compiles the given injective function.
+    gather_table(const index_function<L0,L1>&);
+};
+
+// Pushes forward the bitvector along the function compiled into the
+// given `gather_table`, as `push_forward` along the `index_function`.
+template<int L0, int L1>
+bit_vector<L1> push_forward(
+    const gather_table<L0,L1>&, const bit_vector<L0>&
+);
+// Pushes forward the signvector along the function compiled into the
+// given `gather_table`, as `push_forward` along the `index_function`.
+template<int L0, int L1>
+sign_vector<L1> push_forward(
+    const gather_table<L0,L1>&, const sign_vector<L0>&
+);
+
 // =======================
 //        Operations
 //   and formal products
@@ -402,6 +440,26 @@ struct PushForward: Operation<T0,T1> {
     constexpr T1 operator()(const T0& arg) const { return applied(arg); }
 };
 
+// Behaves identically to a `PushForward` along the same function,
+// but it is applied using a `gather_table`. Compiling the table is
+// slower than applying the function once, so this only pays off if
+// the operation is applied many times.
+template<typename T0, typename T1>
+struct CompiledPushForward: Operation<T0,T1> {
+    constexpr static const int L0 = T0::LENGTH;
+    constexpr static const int L1 = T1::LENGTH;
+
+    gather_table<L0, L1> table;
+
+    CompiledPushForward(): table() {}
+    CompiledPushForward(const index_function<L0, L1>& f): table(f) {}
+    CompiledPushForward(const PushForward<T0, T1>& p): table(p.function) {}
+
+    T1 applied(const T0&) const;
+    T1 operator*(const T0& arg) const { return applied(arg); }
+    T1 operator()(const T0& arg) const { return applied(arg); }
+};
+
 template<typename T0, typename T1>
 struct PullBack: Operation<T0,T1> {
     constexpr static const int L0 = T0::LENGTH;
@@ -79,6 +79,46 @@ sign_vector<L0> pull_back(
     };
 }
 
+// ================
+//   gather_table
+// ================
+
+template<int L0, int L1>
+gather_table<L0, L1>::gather_table(const index_function<L0,L1>& f):
+images(256 * NR_BYTES) {
+    for (auto k = 0; k < NR_BYTES; k++) {
+        for (auto value = 0; value < 256; value++) {
+            auto& image = images[256 * k + value];
+            for (auto bit = 0; bit < 8; bit++) {
+                auto idx = 8 * k + bit;
+                if (idx < L0 && (value >> bit & 1)) image[f.i[idx]] |= (uint32_t)1 << f.r[idx];
+            }
+        }
+    }
+}
+
+template<int L0, int L1>
+bit_vector<L1> push_forward(
+    const gather_table<L0,L1>& table, const bit_vector<L0>& v
+) {
+    auto ret = bit_vector<L1>();
+    for (auto k = 0; k < gather_table<L0,L1>::NR_BYTES; k++) {
+        const auto& image = table.images[256 * k + (v[k >> 2] >> 8 * (k & 3) & 255)];
+        for (auto i = 0; i < bit_vector<L1>::NR_INT32; i++) ret[i] |= image[i];
+    }
+    return ret;
+}
+
+template<int L0, int L1>
+sign_vector<L1> push_forward(
+    const gather_table<L0,L1>& table, const sign_vector<L0>& v
+) {
+    return sign_vector<L1>{
+        push_forward(table, v.plus), 
+        push_forward(table, v.minus)
+    };
+}
+
 // ============================
 //   Specific operation types
 // ============================
@@ -118,6 +158,11 @@ constexpr T1 PushForward<T0,T1>::applied(const T0& to) const {
     return {push_forward(function, to)};
 }
 
+template<typename T0, typename T1>
+T1 CompiledPushForward<T0,T1>::applied(const T0& to) const {
+    return {push_forward(table, to)};
+}
+
 template<typename T0, typename T1>
 constexpr T1 PullBack<T0,T1>::applied(const T0& to) const {
     return {pull_back(function, to)};
@@ -7,6 +7,7 @@
 #include <array>
 #include <vector>
 #include <bit>
+#include <functional>
 #include "mymath.hpp"
 
 // ==============
@@ -350,4 +351,23 @@ struct sign_vector {
     friend std::ifstream& operator>> <>(std::ifstream&, sign_vector&);
 };
 
+// ===========
+//   HASHING
+// ===========
+
+// Hashes all 32-bit integers of the bitvector, so that bitvectors (and
+// the matroids derived from them) can be stored in hash sets and maps.
+template<int L>
+struct std::hash<bit_vector<L>> {
+    size_t operator()(const bit_vector<L>&) const noexcept;
+};
+
+// Hashes all 32-bit integers of both bitvectors of the signvector, so
+// that signvectors (and the chirotopes derived from them) can be stored
+// in hash sets and maps.
+template<int L>
+struct std::hash<sign_vector<L>> {
+    size_t operator()(const sign_vector<L>&) const noexcept;
+};
+
 #include "signvectors_impl.hpp"
\ No newline at end of file
@@ -94,7 +94,7 @@ constexpr bit_vector<L>& bit_vector<L>::invert() {
         bits[i] = ~bits[i];
     } 
     bits[NR_INT32 - 1] = ~bits[NR_INT32 - 1] 
-        & (((uint32_t)1 << NR_REMAINING_BITS) - 1);
+        & (~(uint32_t)0 >> (32 - NR_REMAINING_BITS));
     return *this;
 }
 
@@ -105,7 +105,7 @@ constexpr bit_vector<L> bit_vector<L>::inverse() const {
         ret.bits[i] = ~bits[i];
     } 
     ret.bits[NR_INT32 - 1] = ~bits[NR_INT32 - 1] 
-        & (((uint32_t)1 << NR_REMAINING_BITS) - 1);
+        & (~(uint32_t)0 >> (32 - NR_REMAINING_BITS));
     return ret;
 }
 
@@ -168,7 +168,7 @@ std::vector<int> bit_vector<L>::indices_of_ones() const {
             running_index += std::countr_zero(shifted_bitsi);
             indices.push_back(running_index);
             ++running_index;
-            shifted_bitsi = shifted_bitsi >> (1 + std::countr_zero(shifted_bitsi));
+            shifted_bitsi = (shifted_bitsi >> std::countr_zero(shifted_bitsi)) >> 1;
         }
     }
     return indices;
@@ -184,17 +184,17 @@ std::vector<int> bit_vector<L>::indices_of_zeros() const {
             running_index += std::countr_zero(shifted_bitsi);
             indices.push_back(running_index);
             ++running_index;
-            shifted_bitsi = shifted_bitsi >> (1 + std::countr_zero(shifted_bitsi));
+            shifted_bitsi = (shifted_bitsi >> std::countr_zero(shifted_bitsi)) >> 1;
         }
     }
     uint32_t shifted_bitsi = ~bits[NR_INT32 - 1]
-        & (((uint32_t)1 << NR_REMAINING_BITS) - 1);
+        & (~(uint32_t)0 >> (32 - NR_REMAINING_BITS));
     int running_index = 32 * (NR_INT32 - 1);
     while (shifted_bitsi) {
         running_index += std::countr_zero(shifted_bitsi);
         indices.push_back(running_index);
         ++running_index;
-        shifted_bitsi = shifted_bitsi >> (1 + std::countr_zero(shifted_bitsi));
+        shifted_bitsi = (shifted_bitsi >> std::countr_zero(shifted_bitsi)) >> 1;
     }
     return indices;
 }
@@ -442,17 +442,17 @@ std::vector<int> sign_vector<L>::indices_of_zeros() const {
             running_index += std::countr_zero(shifted_bitsi);
             indices.push_back(running_index);
             ++running_index;
-            shifted_bitsi = shifted_bitsi >> (1 + std::countr_zero(shifted_bitsi));
+            shifted_bitsi = (shifted_bitsi >> std::countr_zero(shifted_bitsi)) >> 1;
         }
     }
     uint32_t shifted_bitsi = ~(plus[NR_INT32 - 1] | minus[NR_INT32 - 1])
-        & (((uint32_t)1 << NR_REMAINING_BITS) - 1);
+        & (~(uint32_t)0 >> (32 - NR_REMAINING_BITS));
     int running_index = 32 * (NR_INT32 - 1);
     while (shifted_bitsi) {
         running_index += std::countr_zero(shifted_bitsi);
         indices.push_back(running_index);
         ++running_index;
-        shifted_bitsi = shifted_bitsi >> (1 + std::countr_zero(shifted_bitsi));
+        shifted_bitsi = (shifted_bitsi >> std::countr_zero(shifted_bitsi)) >> 1;
     }
     return indices;
 }
@@ -477,7 +477,7 @@ std::vector<int> sign_vector<L>::indices_of_nonzeros() const {
             running_index += std::countr_zero(shifted_bitsi);
             indices.push_back(running_index);
             ++running_index;
-            shifted_bitsi = shifted_bitsi >> (1 + std::countr_zero(shifted_bitsi));
+            shifted_bitsi = (shifted_bitsi >> std::countr_zero(shifted_bitsi)) >> 1;
         }
     }
     return indices;
@@ -560,3 +560,23 @@ std::ifstream& operator>>(std::ifstream& ifs, sign_vector<L>& v) {
     v.read(str);
     return ifs;
 }
+
+// ===========
+//   HASHING
+// ===========
+
+template<int L>
+size_t std::hash<bit_vector<L>>::operator()(const bit_vector<L>& v) const noexcept {
+    uint64_t h = L;
+    for (auto i = 0; i < bit_vector<L>::NR_INT32; i++) {
+        h = (h ^ v[i]) * 0x9E3779B97F4A7C15ull;
+        h ^= h >> 29;
+    }
+    return h;
+}
+
+template<int L>
+size_t std::hash<sign_vector<L>>::operator()(const sign_vector<L>& v) const noexcept {
+    std::hash<bit_vector<L>> hash;
+    return hash(v.plus) * 0xBF58476D1CE4E5B9ull ^ hash(v.minus);
+}
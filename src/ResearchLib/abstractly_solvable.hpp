@@ -1,5 +1,8 @@
 #pragma once
 
+#include <array>
+#include <mutex>
+#include <optional>
 #include <vector>
 #include "OMtools.hpp"
 #include "lowercones.hpp"
@@ -23,15 +26,85 @@ constexpr int minimum_N_for_not_abstractly_solvable<3> = 7; //NOLINT
 // at least `minimum_N_for_not_abstractly_solvable<R> - 1`
 // nonloops, sorted into subvectors by basecount (shifted
 // down by 1), but may contain more matroids.
+//
+// The weak insertion problems are solvable if deleting `element` from
+// the lower cone of `chi` hits every chirotope in the lower cone of
+// the deletion. The latter are looked up in a hash table, and the
+// former are deleted in blocks and looked up by `nr_threads` threads,
+// stopping once everything is hit.
 template<int R, int N>
 bool is_always_abstractly_solvabe(
     const Chirotope<R, N>& chi,
     int element,
     const std::vector<Chirotope<R, N>>& lower_cone_of_chi,
     const std::vector<std::vector<Matroid<R, N>>>& matroids_to_filter_deletion_with,
-    enum verboseness verbose = verboseness::result
+    enum verboseness verbose = verboseness::result,
+    unsigned nr_threads = parallel::default_number_of_threads()
 );
 
+// The data shared by the checks of `is_always_abstractly_solvabe` for
+// all elements of one target chirotope `chi`: its lower cone is
+// computed at most once, on the first check, and the lower cone of
+// each deletion `chi\e` at most once for each element.
+//
+// The lower cones of the deletions are not derived from that of `chi`,
+// since whether every weak map image of `chi\e` is the deletion of a
+// weak map image of `chi` is precisely what is being checked.
+//
+// The given matroids and lower cone are referred to, not copied, so
+// they must outlive the context. The checks of distinct elements may
+// run on several threads at once.
+template<int R, int N>
+class AbstractSolvabilityContext {
+public:
+    // The lower cone of `chi` is computed using `matroids`, which must
+    // contain all matroids with at least
+    // `minimum_N_for_not_abstractly_solvable<R>` many nonloops, and
+    // `matroids_to_filter_deletion_with` is as in
+    // `is_always_abstractly_solvabe`.
+    AbstractSolvabilityContext(
+        const Chirotope<R, N>& chi,
+        const std::vector<std::vector<Matroid<R, N>>>& matroids,
+        const std::vector<std::vector<Matroid<R, N>>>& matroids_to_filter_deletion_with
+    );
+    // Uses the given lower cone of `chi`, as in `is_always_abstractly_solvabe`.
+    AbstractSolvabilityContext(
+        const Chirotope<R, N>& chi,
+        const std::vector<Chirotope<R, N>>& lower_cone_of_chi,
+        const std::vector<std::vector<Matroid<R, N>>>& matroids_to_filter_deletion_with
+    );
+    AbstractSolvabilityContext(const AbstractSolvabilityContext&) = delete;
+
+    // Returns the weak map images of `chi` with at least
+    // `minimum_N_for_not_abstractly_solvable<R>` many nonloops.
+    const std::vector<Chirotope<R, N>>& lower_cone_of_chi(
+        enum verboseness verbose = verboseness::result
+    );
+    // Returns the weak map images of `chi\element` with at least
+    // `minimum_N_for_not_abstractly_solvable<R> - 1` many nonloops.
+    const std::vector<Chirotope<R, N>>& lower_cone_of_deletion(
+        int element,
+        enum verboseness verbose = verboseness::result
+    );
+    // Same as `is_always_abstractly_solvabe` for `chi` and `element`.
+    bool is_always_abstractly_solvable(
+        int element,
+        enum verboseness verbose = verboseness::result,
+        unsigned nr_threads = parallel::default_number_of_threads()
+    );
+
+private:
+    Chirotope<R, N> chi;
+    const std::vector<std::vector<Matroid<R, N>>>* matroids = nullptr;
+    const std::vector<std::vector<Matroid<R, N>>>* matroids_to_filter_deletion_with;
+    // Points to the given lower cone of `chi`, or to `computed_lower_cone`
+    // once it is computed.
+    const std::vector<Chirotope<R, N>>* lower_cone = nullptr;
+    std::vector<Chirotope<R, N>> computed_lower_cone;
+    std::once_flag lower_cone_is_set;
+    std::array<std::optional<std::vector<Chirotope<R, N>>>, N> lower_cones_of_deletions;
+};
+
 // This is the same as a different function of the same name,
 // but some input variables are computed automatically.
 // `matroids` must contain all matroids with at least
@@ -44,18 +117,8 @@ bool is_always_abstractly_solvabe(
     const std::vector<std::vector<Matroid<R, N>>>& matroids_to_filter_deletion_with,
     enum verboseness verbose = verboseness::result
 ) {
-    return is_always_abstractly_solvabe(
-        chi,
-        element,
-        lower_cone_with_few_loops(
-            chi, 
-            matroids,
-            N - minimum_N_for_not_abstractly_solvable<R>,
-            verbose
-        ),
-        matroids_to_filter_deletion_with,
-        verbose
-    );
+    AbstractSolvabilityContext<R, N> context(chi, matroids, matroids_to_filter_deletion_with);
+    return context.is_always_abstractly_solvable(element, verbose);
 }
 
 // This is the same as a different function of the same name,
@@ -3,6 +3,10 @@
 #include <iostream>
 #include <vector>
 #include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
 #include "OMtools.hpp"
 #include "lowercones.hpp"
 #include "isolation.hpp"
@@ -17,81 +21,130 @@ bool is_always_abstractly_solvabe(
     int element,
     const std::vector<Chirotope<R, N>>& lower_cone_of_chi,
     const std::vector<std::vector<Matroid<R, N>>>& matroids_to_filter_deletion_with,
+    enum verboseness verbose,
+    unsigned nr_threads
+) {
+    AbstractSolvabilityContext<R, N> context(chi, lower_cone_of_chi, matroids_to_filter_deletion_with);
+    return context.is_always_abstractly_solvable(element, verbose, nr_threads);
+}
+
+template<int R, int N>
+AbstractSolvabilityContext<R, N>::AbstractSolvabilityContext(
+    const Chirotope<R, N>& chi,
+    const std::vector<std::vector<Matroid<R, N>>>& matroids,
+    const std::vector<std::vector<Matroid<R, N>>>& matroids_to_filter_deletion_with
+): chi(chi), matroids(&matroids), 
+matroids_to_filter_deletion_with(&matroids_to_filter_deletion_with) {}
+
+template<int R, int N>
+AbstractSolvabilityContext<R, N>::AbstractSolvabilityContext(
+    const Chirotope<R, N>& chi,
+    const std::vector<Chirotope<R, N>>& lower_cone_of_chi,
+    const std::vector<std::vector<Matroid<R, N>>>& matroids_to_filter_deletion_with
+): chi(chi), matroids_to_filter_deletion_with(&matroids_to_filter_deletion_with),
+lower_cone(&lower_cone_of_chi) {}
+
+template<int R, int N>
+const std::vector<Chirotope<R, N>>& AbstractSolvabilityContext<R, N>::lower_cone_of_chi(
     enum verboseness verbose
 ) {
-    std::array<bool, N> is_loop_in_chi;
-    for (int f = 0; f < N; ++f) {
-        is_loop_in_chi[f] = chi.is_loop(f);
+    std::call_once(lower_cone_is_set, [&] {
+        if (lower_cone != nullptr) return;
+        computed_lower_cone = lower_cone_with_few_loops(
+            chi, 
+            *matroids,
+            N - minimum_N_for_not_abstractly_solvable<R>,
+            verbose
+        );
+        lower_cone = &computed_lower_cone;
+    });
+    return *lower_cone;
+}
+
+template<int R, int N>
+const std::vector<Chirotope<R, N>>& AbstractSolvabilityContext<R, N>::lower_cone_of_deletion(
+    int element,
+    enum verboseness verbose
+) {
+    auto& lc_of_deletion = lower_cones_of_deletions[element];
+    if (!lc_of_deletion) {
+        Chirotope<R,N> deletion = OM_operations::delete_element<R,N>(element)(chi);
+        if (verbose >= verboseness::info) {
+            report() << "- computing lower cone of M\\" << element << " = " << deletion << "...\n";
+        }
+        if (verbose >= verboseness::result) {
+            report() << "For M\\" << element << ", ";
+        }
+        lc_of_deletion = research::lower_cone_with_few_loops(
+            deletion,
+            *matroids_to_filter_deletion_with,
+            N + 1 - minimum_N_for_not_abstractly_solvable<R>, 
+            std::min(verbose, verboseness::result)
+        );
     }
+    return *lc_of_deletion;
+}
+
+template<int R, int N>
+bool AbstractSolvabilityContext<R, N>::is_always_abstractly_solvable(
+    int element,
+    enum verboseness verbose,
+    unsigned nr_threads
+) {
     auto delete_e = OM_operations::delete_element<R,N>(element);
-    Chirotope<R,N> deletion = delete_e(chi);
     if (verbose >= verboseness::info) {
-        std::cout << "Checking that all (loopfree) weak insertion problems"
+        report() << "Checking that all (loopfree) weak insertion problems"
         " of the form (M', " << element << ", M) with M = " << chi << " are abstractly solvable.\n";
-        std::cout << "- computing lower cone of M\\" << element << " = " << deletion << "...\n";
     }
-    if (verbose >= verboseness::result) {
-        std::cout << "For M\\" << element << ", ";
-    }
-    auto lc_of_deletion = research::lower_cone_with_few_loops(
-        deletion,
-        matroids_to_filter_deletion_with,
-        N + 1 - minimum_N_for_not_abstractly_solvable<R>, 
-        std::min(verbose, verboseness::result)
-    );
+    const auto& lower_cone_of_chi = this->lower_cone_of_chi(verbose);
+    const auto& lc_of_deletion = lower_cone_of_deletion(element, verbose);
     if (verbose >= verboseness::info) {
-        std::cout << "- sorting them...\n";
+        report() << "- hashing them...\n";
+    }
+    std::unordered_map<Chirotope<R,N>, uint32_t> index_in_lc_of_deletion;
+    index_in_lc_of_deletion.reserve(lc_of_deletion.size());
+    for (uint32_t idx = 0; idx < lc_of_deletion.size(); ++idx) {
+        index_in_lc_of_deletion.emplace(lc_of_deletion[idx], idx);
     }
-    auto compare = [](const Chirotope<R,N>& l, const Chirotope<R,N>& r){
-        for (auto i = 0; i < Chirotope<R,N>::NR_INT32; ++i) {
-            if ((l.plus[i] | l.minus[i]) == (r.plus[i] | r.minus[i]))
-                continue;
-            return (l.plus[i] | l.minus[i]) < (r.plus[i] | r.minus[i]);
-        }
-        return false;
-    };
-    std::sort(
-        lc_of_deletion.begin(),
-        lc_of_deletion.end(),
-        compare
-    );
     if (verbose >= verboseness::info) {
-        std::cout << "- deleting " << element << " from lower cone of M, "
+        report() << "- deleting " << element << " from lower cone of M, "
         "seeing what is hit in the lower cone of M\\" << element << "...\n";
     }
-    std::vector<bool> was_hit(lc_of_deletion.size(),false);
-    for (Chirotope<R,N> wmi: lower_cone_of_chi) {
-        const Chirotope<R,N> wmi_minus_e = delete_e(wmi);
-        if (wmi_minus_e.is_zero()) continue; // element was a coloop!
-        // Binary search
-        int lower_bound = 0;
-        int upper_bound = lc_of_deletion.size() - 1;
-        int midpoint = (lower_bound + upper_bound) / 2;
-        while (midpoint != upper_bound) {
-            if (compare(lc_of_deletion[midpoint], wmi_minus_e)) {
-                lower_bound = midpoint + 1;
-            } else {
-                upper_bound = midpoint;
+    // Bit `idx % 64` of `was_hit[idx / 64]` is set once `lc_of_deletion[idx]`
+    // is hit. The lower cone of `chi` is processed in blocks, each in one
+    // parallel pass which deletes `element` by masking the words, so that
+    // the rest of it can be skipped once everything is hit.
+    std::vector<std::atomic<uint64_t>> was_hit((lc_of_deletion.size() + 63) / 64);
+    std::atomic<size_t> nr_hit{0};
+    constexpr size_t BLOCK_SIZE = 1 << 16;
+    for (size_t start = 0; 
+    start < lower_cone_of_chi.size() && nr_hit.load() < lc_of_deletion.size(); 
+    start += BLOCK_SIZE) {
+        size_t end = std::min(start + BLOCK_SIZE, lower_cone_of_chi.size());
+        parallel::for_each_index(start, end, [&](size_t idx) {
+            Chirotope<R,N> deletion = delete_e(lower_cone_of_chi[idx]);
+            if (deletion.is_zero()) return; // element was a coloop!
+            auto itr = index_in_lc_of_deletion.find(deletion);
+            if (itr == index_in_lc_of_deletion.end()) return;
+            uint64_t bit = uint64_t(1) << (itr->second % 64);
+            if (!(was_hit[itr->second / 64].fetch_or(bit, std::memory_order_relaxed) & bit)) {
+                nr_hit.fetch_add(1, std::memory_order_relaxed);
             }
-            midpoint = (lower_bound + upper_bound) / 2;
-        }
-        if (lc_of_deletion[midpoint] == wmi_minus_e) {
-            was_hit[midpoint] = true;
-        }
-    } 
+        }, nr_threads, 1024);
+    }
     int not_hit_idx = -1;
-    for (int idx = 0; idx < was_hit.size(); ++idx) {
-        if (!was_hit[idx]) {
+    for (int idx = 0; idx < lc_of_deletion.size(); ++idx) {
+        if (!((was_hit[idx / 64].load() >> (idx % 64)) & 1)) {
             not_hit_idx = idx;
             break;
         }
     }
     if (verbose >= verboseness::result) {
         if (not_hit_idx == -1) {
-            std::cout << "[SUCCESS] All weak insertion problems of the form (M', "
+            report() << "[SUCCESS] All weak insertion problems of the form (M', "
             << element << ", M) with M = " << chi << " are abstractly solvable\n";
         } else {
-            std::cout << "The chirotope " << lc_of_deletion[not_hit_idx]
+            report() << "The chirotope " << lc_of_deletion[not_hit_idx]
             << " has no single element extension which is\nsmaller than  " << chi << ".\n";
         }
     }
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <array>
+#include <vector>
+#include "OMtools.hpp"
+#include "research_file_template.hpp"
+
+namespace research {
+
+// Calls `callback(chi)` for every chirotope `chi` in the closed interval
+// between the oriented matroids `lo` and `hi` in the weak map order,
+// i.e. for which `hi.OM_weak_maps_to(chi)` and `chi.OM_weak_maps_to(lo)`.
+// Every such oriented matroid is reported once, by the chirotope which
+// agrees with `hi` on its bases. The callback may be called concurrently
+// from `nr_threads` threads.
+//
+// These chirotopes are restrictions of `hi` to sets of bases containing
+// the bases of `lo`, so only the values on the remaining bases of `hi`
+// have to be chosen; see `SignAssignmentSearch` for how the chirotope
+// axioms are used to prune this choice.
+template<int R, int N, typename Callback>
+void for_each_in_interval(
+    const Chirotope<R, N>& lo,
+    const Chirotope<R, N>& hi,
+    Callback&& callback,
+    unsigned nr_threads = parallel::default_number_of_threads()
+);
+
+// Returns the chirotopes in the closed interval between `lo` and `hi`
+// (see `for_each_in_interval`), grouped by basecount. The index is
+// shifted by 1 from the actual basecount.
+template<int R, int N>
+std::vector<std::vector<Chirotope<R, N>>> interval(
+    const Chirotope<R, N>& lo,
+    const Chirotope<R, N>& hi,
+    unsigned nr_threads = parallel::default_number_of_threads()
+);
+
+// Computes the face vector of the order complex of the open interval
+// strictly between `lo` and `hi` in the weak map order.
+template<int R, int N>
+std::array<size_t, binomial_coefficient(N, R)> open_interval_face_vector(
+    const Chirotope<R, N>& lo,
+    const Chirotope<R, N>& hi,
+    unsigned nr_threads = parallel::default_number_of_threads()
+);
+
+// Computes the Euler characteristic of the order complex of the open
+// interval strictly between `lo` and `hi` in the weak map order.
+template<int R, int N>
+long long open_interval_euler_characteristic(
+    const Chirotope<R, N>& lo,
+    const Chirotope<R, N>& hi,
+    unsigned nr_threads = parallel::default_number_of_threads()
+) {
+    return euler_characteristic<binomial_coefficient(N, R)>(
+        open_interval_face_vector(lo, hi, nr_threads)
+    );
+}
+
+}
+
+#include "intervals_impl.hpp"
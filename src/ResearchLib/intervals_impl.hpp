@@ -0,0 +1,71 @@
+#pragma once
+
+#include <mutex>
+#include <vector>
+#include "OMtools.hpp"
+#include "research_file_template.hpp"
+#include "intervals.hpp"
+
+namespace research {
+
+template<int R, int N, typename Callback>
+void for_each_in_interval(
+    const Chirotope<R, N>& lo,
+    const Chirotope<R, N>& hi,
+    Callback&& callback,
+    unsigned nr_threads
+) {
+    using SEARCH = SignAssignmentSearch<R, N>;
+    Chirotope<R, N> bottom;
+    if (hi.weak_maps_to(lo)) bottom = lo;
+    else if (hi.weak_maps_to(lo.inverse())) bottom = lo.inverse();
+    else return;
+    SEARCH search;
+    for (int b = 0; b < SEARCH::NR; ++b) {
+        if (bottom.is_basis(b)) {
+            search.fix(b, bottom.evaluate(b));
+        } else if (hi.is_basis(b)) {
+            search.tie(b, search.add_variable(
+                SEARCH::ZERO | (hi.get_plus(b) ? SEARCH::PLUS : SEARCH::MINUS)
+            ));
+        }
+    }
+    search.for_each_chirotope([&callback](unsigned, const Chirotope<R, N>& chi) {
+        callback(chi);
+    }, nr_threads);
+}
+
+template<int R, int N>
+std::vector<std::vector<Chirotope<R, N>>> interval(
+    const Chirotope<R, N>& lo,
+    const Chirotope<R, N>& hi,
+    unsigned nr_threads
+) {
+    std::vector<std::vector<Chirotope<R, N>>> by_basecount(binomial_coefficient(N, R));
+    std::mutex mutex;
+    for_each_in_interval(lo, hi, [&](const Chirotope<R, N>& chi) {
+        std::lock_guard<std::mutex> lock(mutex);
+        by_basecount[chi.countbases() - 1].push_back(chi);
+    }, nr_threads);
+    return by_basecount;
+}
+
+template<int R, int N>
+std::array<size_t, binomial_coefficient(N, R)> open_interval_face_vector(
+    const Chirotope<R, N>& lo,
+    const Chirotope<R, N>& hi,
+    unsigned nr_threads
+) {
+    constexpr int NR = binomial_coefficient(N, R);
+    auto closed_interval = interval(lo, hi, nr_threads);
+    // Remove the endpoints.
+    for (auto& chirotopes : closed_interval) {
+        std::erase_if(chirotopes, [&](const Chirotope<R, N>& chi) {
+            return chi.is_same_OM_as(lo) || chi.is_same_OM_as(hi);
+        });
+    }
+    auto poset = OMPoset<R, N>::with_comparabilities(closed_interval, nr_threads);
+    return face_vector<NR>(poset.template lower_cone_face_vectors<NR>(nr_threads));
+}
+
+}
@@ -1,6 +1,10 @@
 #pragma once
 
+#include <cstdint>
+#include <array>
 #include <span>
+#include <unordered_map>
+#include <vector>
 #include "OMtools.hpp"
 #include "mymath.hpp"
 #include "research_file_template.hpp"
@@ -10,9 +14,31 @@ namespace research {
 // Returns whether the given cocircuit constrains the given
 // element in the given oriented matroid, i.e. if kernel 
 // (without possibly the element) is of rank `R-1`.
+//
+// `ConstrainsTable` computes this for all cocircuits at once; this
+// plain version serves as the reference in `programs::verify_isolation`.
 template<int R, int N>
 bool constrains(const Chirotope<R, N>&, const sign_vector<N>&, char);
 
+// The result of `constrains` for every cocircuit in a list of cocircuits
+// of a chirotope and every element, computed once so that it can be
+// shared by all elements. The zero set of each cocircuit is scanned for
+// a maximal independent subset only once: all elements outside of it
+// are constrained if it has rank `R-1`, so only removing the `R-1`
+// elements of the subset needs another rank computation.
+template<int R, int N>
+struct ConstrainsTable {
+    // Bit `e` of `constrained[j]` is set if the `j`th cocircuit
+    // constrains the element `e`.
+    std::vector<uint64_t> constrained;
+
+    ConstrainsTable(const Chirotope<R, N>&, const std::vector<sign_vector<N>>&);
+
+    // Returns whether the `j`th cocircuit constrains the given element.
+    bool operator()(int j, char element) const
+    { return (constrained[j] >> element) & 1; }
+};
+
 // Returns whether there is a non-loop element, distinct form
 // the given one, for which none of the given cocircuits (given 
 // through pointers) of the given chirotope take `+` or none of
@@ -20,6 +46,9 @@ bool constrains(const Chirotope<R, N>&, const sign_vector<N>&, char);
 //
 // If the template parameter `loopfree` is true, it is assumed that
 // the given oriented matroid is loopfree.
+//
+// `is_isolated` tracks the same masks incrementally; this plain
+// version serves as the reference in `programs::verify_isolation`.
 template<int R, int N, bool loopfree=false>
 bool exists_covariant_nonloop(const Chirotope<R, N>&, std::span<const sign_vector<N>*,R>, char);
 
@@ -35,11 +64,61 @@ bool exists_covariant_nonloop(const Chirotope<R, N>&, std::span<const sign_vecto
 // that the `C[i]` is either never `+` or never `-` on `w`.
 // Note that this means that loops can easily be isolated.
 //
+// The constraining cocircuits are packed into `64`-bit masks (see
+// `_packed_mask`), and the `R`-subsets are enumerated depth first,
+// keeping the masks of elements on which none of the chosen cocircuits
+// is `+` (resp. `-`) for every prefix of the subset, so each step costs
+// two AND operations. Reversing a cocircuit swaps its two masks, and
+// the search stops as soon as both masks avoid every candidate nonloop.
+//
 // Changes the sign of certain cocircuits in `cocircuits`.
 // If the template parameter `loopfree` is true, it is assumed that
 // the given oriented matroid is loopfree.
 template<int R, int N, bool loopfree=false>
 bool is_isolated(const Chirotope<R, N>&, std::vector<sign_vector<N>>&, char);
+// Same as above, but the cocircuits constraining the element are read
+// off a precomputed table of the given cocircuits. Reversing cocircuits
+// does not invalidate the table.
+template<int R, int N, bool loopfree=false>
+bool is_isolated(
+    const Chirotope<R, N>&, 
+    std::vector<sign_vector<N>>&, 
+    const ConstrainsTable<R, N>&, 
+    char
+);
+
+// Returns the bits of the given bit vector as a single `64`-bit mask,
+// bit `w` standing for element `w`.
+template<int N>
+uint64_t _packed_mask(const bit_vector<N>&);
+
+// The deletions of a chirotope by sets of elements (bit `e` standing
+// for element `e`), with their cocircuits and `ConstrainsTable`s, each
+// computed on the first request. The cocircuits of a deletion are
+// derived from those of the deletion by one element less, using
+// `OM_operations::cocircuits_of_deletion`, so walking the lattice of
+// deleted sets upwards only takes incremental updates.
+template<int R, int N>
+class DeletionCache {
+public:
+    struct Deletion {
+        Chirotope<R, N> chirotope;
+        std::vector<sign_vector<N>> cocircuits;
+        ConstrainsTable<R, N> constrains_table;
+    };
+
+    DeletionCache(const Chirotope<R, N>&);
+
+    // Returns the deletion of the given set of elements from the
+    // chirotope. The reference stays valid for the lifetime of the
+    // cache; the signs of its cocircuits may be changed by the caller
+    // (e.g. by `is_isolated`).
+    Deletion& deletion(uint32_t deleted);
+
+private:
+    std::array<sign_vector_operations::Multiply_P0<Chirotope<R, N>>, N> deleters;
+    std::unordered_map<uint32_t, Deletion> deletions;
+};
 
 // If `N < minimum_N_for_isolation`, then it is guaranteed that
 // no weak insertion problem is isolated.
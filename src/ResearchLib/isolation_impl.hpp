@@ -1,5 +1,6 @@
 #pragma once
 
+#include <bit>
 #include <span>
 #include <vector>
 #include "OMtools.hpp"
@@ -26,6 +27,31 @@ bool constrains (const Chirotope<R, N>& chi, const sign_vector<N>& cocircuit, ch
     }
 }
 
+template<int R, int N>
+ConstrainsTable<R, N>::ConstrainsTable(
+    const Chirotope<R, N>& chi, 
+    const std::vector<sign_vector<N>>& cocircuits
+) {
+    constexpr uint64_t all_elements = N == 64 ? ~uint64_t(0) : (uint64_t(1) << N) - 1;
+    for (const auto& cocircuit: cocircuits) {
+        std::vector<int> zeros = cocircuit.indices_of_zeros();
+        std::vector<char> independent = chi.maximal_independent_subset(zeros, R - 1);
+        if (independent.size() < R - 1) {
+            constrained.push_back(0);
+            continue;
+        }
+        uint64_t mask = all_elements;
+        for (char element: independent) {
+            std::vector<int> other_zeros;
+            for (int z: zeros) if (z != element) other_zeros.push_back(z);
+            if (chi.rank(other_zeros, R - 1) < R - 1) {
+                mask &= ~(uint64_t(1) << element);
+            }
+        }
+        constrained.push_back(mask);
+    }
+}
+
 template<int R, int N, bool loopfree>
 bool exists_covariant_nonloop(const Chirotope<R, N>& chi, 
 std::span<const sign_vector<N>*,R> cocircuits, char element) {
@@ -53,46 +79,102 @@ std::span<const sign_vector<N>*,R> cocircuits, char element) {
 template<int R, int N, bool loopfree>
 bool is_isolated(const Chirotope<R, N>& chi, 
 std::vector<sign_vector<N>>& cocircuits, char element) {
-    std::vector<int> constraining_cocircuit_indices{};
-    std::vector<char> sign_of_element_in_constraining_cocircuit{};
+    return is_isolated<R, N, loopfree>(
+        chi, cocircuits, ConstrainsTable<R, N>(chi, cocircuits), element
+    );
+}
+
+template<int R, int N, bool loopfree>
+bool is_isolated(
+    const Chirotope<R, N>& chi, 
+    std::vector<sign_vector<N>>& cocircuits, 
+    const ConstrainsTable<R, N>& constrains_table, 
+    char element
+) {
+    // The constraining cocircuits, oriented so that they are not `-` on
+    // `element`. Those which are `0` on it may also be reversed.
+    std::vector<uint64_t> plus{};
+    std::vector<uint64_t> minus{};
+    std::vector<bool> reversible{};
     for (int j = 0; j < cocircuits.size(); ++j) {
-        if (constrains(chi, cocircuits[j], element)) {
-            constraining_cocircuit_indices.push_back(j);
-            sign_of_element_in_constraining_cocircuit.push_back(
-                cocircuits[j].get_char(element)
-            );
+        if (constrains_table(j, element)) {
             if (cocircuits[j].minus.get_bit(element)) {
                 cocircuits[j].invert();
             }
+            plus.push_back(_packed_mask(cocircuits[j].plus));
+            minus.push_back(_packed_mask(cocircuits[j].minus));
+            reversible.push_back(!cocircuits[j].plus.get_bit(element));
         }
     }
-    for (std::array<char, R> Rtuple: Rtuples::iterator<char,R>(
-        constraining_cocircuit_indices.size()
-    )) { // Iterate over `R`-element subsets of constraining_cocircuit_indices
-        std::array<bool,R> was_already_flipped{};
-        std::array<sign_vector<N> const *, R> cocircuit_ptrs;
-        for (int t = 0; t < R; ++t) {
-            cocircuit_ptrs[t] = &cocircuits[constraining_cocircuit_indices[Rtuple[t]]];
+    const int nr_constraining = plus.size();
+    if (nr_constraining < R) return false;
+    // The nonloops other than `element`.
+    uint64_t candidates = (N == 64 ? ~uint64_t(0) : (uint64_t(1) << N) - 1) 
+        & ~(uint64_t(1) << element);
+    if constexpr (!loopfree) {
+        for (int w = 0; w < N; ++w) {
+            if (chi.is_loop(w)) candidates &= ~(uint64_t(1) << w);
         }
-        while (true) { // Iterate over each choice of orienting the given cocircuits
-            if (!exists_covariant_nonloop<R,N,loopfree>(chi,cocircuit_ptrs,element)) {
+    }
+    // Chooses the `t`th cocircuit of the subset among those with index at
+    // least `first`, where `no_plus` and `no_minus` are the candidates on
+    // which none of the already chosen cocircuits is `+`, resp. `-`. Once
+    // both are empty, every `R`-subset containing the chosen cocircuits
+    // isolates `element`.
+    auto isolating_subset_exists = [&](
+        auto&& self, int t, int first, uint64_t no_plus, uint64_t no_minus
+    ) -> bool {
+        if ((no_plus | no_minus) == 0) return true;
+        if (t == R) return false;
+        for (int k = first; k + R - t <= nr_constraining; ++k) {
+            if (self(self, t + 1, k + 1, no_plus & ~plus[k], no_minus & ~minus[k])) 
+                return true;
+            if (reversible[k] && 
+            self(self, t + 1, k + 1, no_plus & ~minus[k], no_minus & ~plus[k])) 
                 return true;
-            }
-            int t = R - 1;
-            while(
-                t >= 0 && 
-                (sign_of_element_in_constraining_cocircuit[Rtuple[t]] != '0'
-                || was_already_flipped[t])
-            ) {
-                was_already_flipped[t] = false;
-                --t;
-            }
-            if (t < 0) break;
-            cocircuits[constraining_cocircuit_indices[Rtuple[t]]].invert();
-            was_already_flipped[t] = true;
         }
+        return false;
+    };
+    return isolating_subset_exists(isolating_subset_exists, 0, 0, candidates, candidates);
+}
+
+template<int R, int N>
+DeletionCache<R, N>::DeletionCache(const Chirotope<R, N>& chi) {
+    static_assert(N <= 32, "Sets of elements are stored as 32-bit masks.");
+    for (int e = 0; e < N; ++e) {
+        deleters[e] = OM_operations::delete_element<R, N>(e);
     }
-    return false;
+    auto cocircuits = OM_operations::cocircuits(chi);
+    ConstrainsTable<R, N> constrains_table(chi, cocircuits);
+    deletions.emplace(0, Deletion{chi, std::move(cocircuits), std::move(constrains_table)});
+}
+
+template<int R, int N>
+typename DeletionCache<R, N>::Deletion& DeletionCache<R, N>::deletion(uint32_t deleted) {
+    auto itr = deletions.find(deleted);
+    if (itr != deletions.end()) return itr->second;
+    // Delete the last element from the deletion of the others.
+    int last = 31 - std::countl_zero(deleted);
+    const Deletion& smaller = deletion(deleted & ~(uint32_t(1) << last));
+    auto chirotope = deleters[last](smaller.chirotope);
+    auto cocircuits = OM_operations::cocircuits_of_deletion(
+        smaller.cocircuits, uint32_t(1) << last
+    );
+    ConstrainsTable<R, N> constrains_table(chirotope, cocircuits);
+    return deletions.emplace(
+        deleted, 
+        Deletion{chirotope, std::move(cocircuits), std::move(constrains_table)}
+    ).first->second;
+}
+
+template<int N>
+uint64_t _packed_mask(const bit_vector<N>& v) {
+    static_assert(N <= 64, "Packed masks only support up to 64 elements.");
+    uint64_t mask = v.bits[0];
+    if constexpr (bit_vector<N>::NR_INT32 > 1) {
+        mask |= uint64_t(v.bits[1]) << 32;
+    }
+    return mask;
 }
 
 }
\ No newline at end of file
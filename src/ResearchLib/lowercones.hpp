@@ -19,6 +19,16 @@ std::vector<std::vector<Matroid<R, N>>> read_matroids(
     enum verboseness verbose = verboseness::checkpoints
 );
 
+// Returns the list of all oriented matroids, grouped by basecount.
+// The index is shifted by 1 from the actual basecount. Each OM
+// appears once, represented by one of its two chirotopes.
+//
+// This uses a database of all oriented matroids.
+template<int R, int N>
+std::vector<std::vector<Chirotope<R, N>>> read_OMs(
+    enum verboseness verbose = verboseness::checkpoints
+);
+
 // Return the set of all weak map images of `top`, grouped by basecount.
 // The index is shifted from the basecount by 1.
 //
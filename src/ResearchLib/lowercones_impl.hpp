@@ -14,7 +14,7 @@ std::vector<std::vector<Matroid<R, N>>> read_matroids(
     enum verboseness verbose
 ) {
     if (verbose >= verboseness::info) {
-        std::cout << "Reading the set of all rank " << R
+        report() << "Reading the set of all rank " << R
         << " matroids on " << N << " elements...";
     }
     std::vector<std::vector<Matroid<R, N>>> matroids_by_bases(
@@ -29,7 +29,7 @@ std::vector<std::vector<Matroid<R, N>>> read_matroids(
         // PRINT
         if (p.first != last_basecount) {
             if (verbose >= verboseness::checkpoints) {
-                std::cout << "Finished loading matroids with "
+                report() << "Finished loading matroids with "
                 << last_basecount << " bases. There were " 
                 << matroids_by_bases[last_basecount - 1].size()
                 << " of them.\n";
@@ -40,7 +40,7 @@ std::vector<std::vector<Matroid<R, N>>> read_matroids(
         matroids_by_bases[p.first - 1].push_back(p.second);
     }
     if (verbose >= verboseness::info) {
-        std::cout << "Finished parsing matroids with "
+        report() << "Finished parsing matroids with "
         << last_basecount << " bases. There were " 
         << matroids_by_bases[last_basecount - 1].size()
         << " of them.\n";
@@ -50,19 +50,60 @@ std::vector<std::vector<Matroid<R, N>>> read_matroids(
         for (auto matroids_with_fixed_basecount: matroids_by_bases) {
             total += matroids_with_fixed_basecount.size();
         }
-        std::cout << "Finished reading in all " << total << " matroids"
+        report() << "Finished reading in all " << total << " matroids"
         " of rank " << R << " on " << N << " elements.\n"; 
     }
     return matroids_by_bases;
 }
 
+template<int R, int N>
+std::vector<std::vector<Chirotope<R, N>>> read_OMs(
+    enum verboseness verbose
+) {
+    if (verbose >= verboseness::info) {
+        report() << "Reading the set of all rank " << R
+        << " oriented matroids on " << N << " elements...\n";
+    }
+    std::vector<std::vector<Chirotope<R, N>>> OMs_by_bases(
+        binomial_coefficient(N, R),
+        std::vector<Chirotope<R, N>>()
+    );
+    auto input = ReadOMDataFromFiles<Chirotope<R,N>>(
+        database_names::OM_set<R, N>, 6
+    );
+    int last_basecount = 0;
+    for (auto p : input) {
+        // PRINT
+        if (p.first != last_basecount) {
+            if (verbose >= verboseness::checkpoints && last_basecount > 0) {
+                report() << "Finished loading OMs with "
+                << last_basecount << " bases. There were " 
+                << OMs_by_bases[last_basecount - 1].size()
+                << " of them.\n";
+            }
+            last_basecount = p.first;
+        }
+        // PARSE
+        OMs_by_bases[p.first - 1].push_back(p.second);
+    }
+    if (verbose >= verboseness::result) {
+        size_t total = 0;
+        for (auto& OMs_with_fixed_basecount: OMs_by_bases) {
+            total += OMs_with_fixed_basecount.size();
+        }
+        report() << "Finished reading in all " << total << " oriented matroids"
+        " of rank " << R << " on " << N << " elements.\n"; 
+    }
+    return OMs_by_bases;
+}
+
 template<int R, int N>
 std::vector<std::vector<Chirotope<R,N>>> generate_lower_cone(
     const Chirotope<R, N>& top, 
     enum verboseness verbose
 ) {
     if (!top.is_chirotope() && verbose >= verboseness::info)
-        std::cout << "[WARNING] top is not a chirotope.\n";
+        report() << "[WARNING] top is not a chirotope.\n";
     std::vector<std::vector<Chirotope<R,N>>> all_wmis_by_basecount(
         binomial_coefficient(N, R), std::vector<Chirotope<R,N>>()
     );
@@ -70,7 +111,7 @@ std::vector<std::vector<Chirotope<R,N>>> generate_lower_cone(
         database_names::matroid_set<R,N>, 0
     );
     if (verbose >= verboseness::info) {
-        std::cout << "Generating lower cone of " << top << "...\n";
+        report() << "Generating lower cone of " << top << "...\n";
     }
     int last_basecount = 0;
     size_t total = 0;
@@ -81,7 +122,7 @@ std::vector<std::vector<Chirotope<R,N>>> generate_lower_cone(
     for (auto p : input) {
         if (top_basecount == p.first) {
             if (verbose >= verboseness::info) {
-                std::cout << "We have exhausted all basecounts smaller than"
+                report() << "We have exhausted all basecounts smaller than"
                 " top's basecount (" << top_basecount << ").\n";
             }
             if (top.is_chirotope())
@@ -91,11 +132,11 @@ std::vector<std::vector<Chirotope<R,N>>> generate_lower_cone(
         // PRINT
         if (p.first != last_basecount) {
             if (verbose >= verboseness::checkpoints) {
-                std::cout << "Finished parsing matroids with "
+                report() << "Finished parsing matroids with "
                 << last_basecount << " bases.\n";
-                std::cout << "--- There were " << count_of_wmi_with_fixed_basecount 
+                report() << "--- There were " << count_of_wmi_with_fixed_basecount 
                 << "/" << matroids_with_fixed_basecount << " weak map images for this basecount\n";
-                std::cout << "--- There are " << count_of_wmi << "/"
+                report() << "--- There are " << count_of_wmi << "/"
                 << total << " weak map images in total so far.\n";
             }
             matroids_with_fixed_basecount = 0;
@@ -116,15 +157,15 @@ std::vector<std::vector<Chirotope<R,N>>> generate_lower_cone(
         total++;
     }
     if (verbose >= verboseness::checkpoints) {
-        std::cout << "Finished parsing matroids with "
+        report() << "Finished parsing matroids with "
         << last_basecount << " bases.\n";
-        std::cout << "--- There were " << count_of_wmi_with_fixed_basecount 
+        report() << "--- There were " << count_of_wmi_with_fixed_basecount 
         << "/" << matroids_with_fixed_basecount << " weak map images for this basecount.\n";
-        std::cout << "--- There are " << count_of_wmi << "/"
+        report() << "--- There are " << count_of_wmi << "/"
         << total << " weak map images in total so far.\n";
     }
     if (verbose >= verboseness::info) {
-        std::cout << "Generation of the lower cone of " << top << " is complete, found "
+        report() << "Generation of the lower cone of " << top << " is complete, found "
         << count_of_wmi << "/" << total << " weak map images.\n";
     }
     return all_wmis_by_basecount;
@@ -137,9 +178,9 @@ std::vector<std::vector<Chirotope<R, N>>> generate_lower_cone(
     enum verboseness verbose
 ) {
     if (!top.is_chirotope() && verbose >= verboseness::info)
-        std::cout << "[WARNING] top is not a chirotope.\n";
+        report() << "[WARNING] top is not a chirotope.\n";
     if (verbose >= verboseness::info) {
-        std::cout << "Generating lower cone of " << top << 
+        report() << "Generating lower cone of " << top << 
         ", given the set of appropriate matroids...\n";
     }
     std::vector<std::vector<Chirotope<R, N>>> all_wmis_by_bases(
@@ -163,18 +204,18 @@ std::vector<std::vector<Chirotope<R, N>>> generate_lower_cone(
         }
         total += matroids[b].size();
         if (verbose >= verboseness::checkpoints) {
-            std::cout << "Finished parsing matroids with " << b+1
+            report() << "Finished parsing matroids with " << b+1
             << " bases.\n";
-            std::cout << "--- There were " << count_of_wmi_with_fixed_basecount
+            report() << "--- There were " << count_of_wmi_with_fixed_basecount
             << "/" << matroids[b].size() << " weak map images for this basecount.\n";
-            std::cout << "--- There are " << count_of_wmi << "/"
+            report() << "--- There are " << count_of_wmi << "/"
             << total << " weak map images in total so far.\n";
         }
     }
     if (top.is_chirotope()) 
         all_wmis_by_bases[top_basecount - 1].push_back(top);
     if (verbose >= verboseness::info) {
-        std::cout << "Generation of the lower cone of "
+        report() << "Generation of the lower cone of "
         << top << " is complete; we have checked all relevant basecounts.\n";
     }
     return all_wmis_by_bases;
@@ -186,7 +227,7 @@ std::vector<std::vector<Chirotope<R, N>>> filter_lower_cone(
     enum verboseness verbose
 ) {
     if (!top.is_chirotope() && verbose >= verboseness::info)
-        std::cout << "[WARNING] top is not a chirotope.\n";
+        report() << "[WARNING] top is not a chirotope.\n";
 
     std::vector<std::vector<Chirotope<R,N>>> all_wmis_by_basecount(
         binomial_coefficient(N, R), std::vector<Chirotope<R,N>>()
@@ -197,7 +238,7 @@ std::vector<std::vector<Chirotope<R, N>>> filter_lower_cone(
     );
 
     if (verbose >= verboseness::info) {
-        std::cout << "Reading all OMs with R = " << R << " and N = " << N
+        report() << "Reading all OMs with R = " << R << " and N = " << N
         << ", and keeping those which are in the lower cone of " << top
         << "...\n";
     }
@@ -210,7 +251,7 @@ std::vector<std::vector<Chirotope<R, N>>> filter_lower_cone(
     for (auto p : input) {
         if (top_basecount == p.first) {
             if (verbose >= verboseness::info) {
-                std::cout << "Finished with exhausting all basecounts smaller than"
+                report() << "Finished with exhausting all basecounts smaller than"
                 " top's basecount (" << top_basecount << ").\n";
             }
             if (top.is_chirotope()) 
@@ -220,11 +261,11 @@ std::vector<std::vector<Chirotope<R, N>>> filter_lower_cone(
         // PRINT
         if (last_basecount != p.first) {
             if (verbose >= verboseness::checkpoints) {
-                std::cout << "Finished parsing OMs with " << last_basecount
+                report() << "Finished parsing OMs with " << last_basecount
                 << " bases.\n";
-                std::cout << "--- There were " << count_of_wmi_with_fixed_basecount
+                report() << "--- There were " << count_of_wmi_with_fixed_basecount
                 << "/" << OMs_with_fixed_basecount << " weak map images for this basecount.\n";
-                std::cout << "--- There are " << count_of_wmi << "/"
+                report() << "--- There are " << count_of_wmi << "/"
                 << total << " weak map images in total so far.\n";
             }
             last_basecount = p.first;
@@ -243,15 +284,15 @@ std::vector<std::vector<Chirotope<R, N>>> filter_lower_cone(
         OMs_with_fixed_basecount++;
     }
     if (verbose >= verboseness::checkpoints) {
-        std::cout << "Finished parsing OMs with " << last_basecount
+        report() << "Finished parsing OMs with " << last_basecount
         << " bases.\n";
-        std::cout << "--- There were " << count_of_wmi_with_fixed_basecount
+        report() << "--- There were " << count_of_wmi_with_fixed_basecount
         << "/" << OMs_with_fixed_basecount << " weak map images for this basecount.\n";
-        std::cout << "--- There are " << count_of_wmi << "/"
+        report() << "--- There are " << count_of_wmi << "/"
         << total << " weak map images in total so far.\n";
     } 
     if (verbose >= verboseness::result) {
-        std::cout << "Filtering of the lower cone of " << top << " is complete.\n";
+        report() << "Filtering of the lower cone of " << top << " is complete.\n";
     }
     return all_wmis_by_basecount;
 }
@@ -276,7 +317,7 @@ std::vector<Chirotope<R, N>> lower_cone_with_few_loops(
             }
         }
         if (verbose >= verboseness::checkpoints) {
-            std::cout << kept_with_basecount << "/" << wmis_with_fixed_basecount.size()
+            report() << kept_with_basecount << "/" << wmis_with_fixed_basecount.size()
             << " weak map images with " << basecount << " bases had at most "
             << max_nr_of_loops << " loops.\n";
         }
@@ -284,7 +325,7 @@ std::vector<Chirotope<R, N>> lower_cone_with_few_loops(
         wmis_total += wmis_with_fixed_basecount.size();
     }
     if (verbose >= verboseness::result) {
-        std::cout << kept_total << "/" << wmis_total << " weak map images had "
+        report() << kept_total << "/" << wmis_total << " weak map images had "
         "at most " << max_nr_of_loops << " loops.\n";
     }
     return loopfrees;
@@ -311,7 +352,7 @@ std::vector<Chirotope<R, N>> lower_cone_with_few_loops(
             }
         }
         if (verbose >= verboseness::checkpoints) {
-            std::cout << kept_with_basecount << "/" << wmis_with_fixed_basecount.size()
+            report() << kept_with_basecount << "/" << wmis_with_fixed_basecount.size()
             << " weak map images with " << basecount << " bases had at most "
             << max_nr_of_loops << " loops.\n";
         }
@@ -319,7 +360,7 @@ std::vector<Chirotope<R, N>> lower_cone_with_few_loops(
         wmis_total += wmis_with_fixed_basecount.size();
     }
     if (verbose >= verboseness::result) {
-        std::cout << kept_total << "/" << wmis_total << " weak map images had "
+        report() << kept_total << "/" << wmis_total << " weak map images had "
         "at most " << max_nr_of_loops << " loops.\n";
     }
     return loopfrees;
@@ -332,7 +373,7 @@ std::vector<std::vector<Matroid<R, N>>> matroids_with_few_loops(
 ) {
     auto matroids_unfiltered = research::read_matroids<R, N>(verbose);
     if (verbose >= verboseness::info) {
-        std::cout << "Filtering out matroids which have more than "
+        report() << "Filtering out matroids which have more than "
         << max_nr_of_loops << " loops...\n";
     }
     int basecount = 1;
@@ -350,7 +391,7 @@ std::vector<std::vector<Matroid<R, N>>> matroids_with_few_loops(
             }
         }
         if (verbose >= verboseness::checkpoints) {
-            std::cout << "- for basecount " << basecount
+            report() << "- for basecount " << basecount
             << " kept " << filtered.size() << "/" << matroids_with_fixed_bases.size()
             << "\n";
         }
@@ -360,7 +401,7 @@ std::vector<std::vector<Matroid<R, N>>> matroids_with_few_loops(
         basecount++;
     }
     if (verbose >= verboseness::result) {
-        std::cout << "In total, found " << total_kept << "/"
+        report() << "In total, found " << total_kept << "/"
         << total << " matroids with at most " << max_nr_of_loops
         << " loops.\n";
     }
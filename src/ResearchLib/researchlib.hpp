@@ -3,9 +3,11 @@
 #include "verboseness.hpp"
 #include "moreRtuples.hpp"
 #include "lowercones.hpp"
+#include "uppercones.hpp"
 #include "isolation.hpp"
 #include "read_Finschi.hpp"
 #include "abstractly_solvable.hpp"
 #include "weakly_reducible.hpp"
 #include "numerical_invariants.hpp"
-#include "contractibility.hpp"
\ No newline at end of file
+#include "contractibility.hpp"
+#include "intervals.hpp"
\ No newline at end of file
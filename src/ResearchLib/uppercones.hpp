@@ -0,0 +1,39 @@
+#pragma once
+
+#include <vector>
+#include "OMtools.hpp"
+#include "research_file_template.hpp"
+#include "verboseness.hpp"
+
+namespace research {
+
+// Calls `callback(chi)` for every chirotope `chi` strictly above the
+// oriented matroid `bottom` in the weak map order, i.e. for which
+// `chi.OM_weak_maps_to(bottom)` and `chi` is not `bottom` or its
+// inverse. Every such oriented matroid is reported once, by the
+// chirotope which agrees with `bottom` on the bases of `bottom`. The
+// callback may be called concurrently from `nr_threads` threads.
+//
+// No database is needed: the values on the non-bases of `bottom` are
+// chosen by a `SignAssignmentSearch`, which prunes using the three-term
+// Grassmann-Plucker relations.
+template<int R, int N, typename Callback>
+void for_each_in_upper_cone(
+    const Chirotope<R, N>& bottom,
+    Callback&& callback,
+    unsigned nr_threads = parallel::default_number_of_threads()
+);
+
+// Return the set of all chirotopes strictly above `bottom` in the weak
+// map order (see `for_each_in_upper_cone`), grouped by basecount. The
+// index is shifted from the basecount by 1.
+template<int R, int N>
+std::vector<std::vector<Chirotope<R, N>>> generate_upper_cone(
+    const Chirotope<R, N>& bottom,
+    enum verboseness verbose = verboseness::result,
+    unsigned nr_threads = parallel::default_number_of_threads()
+);
+
+}
+
+#include "uppercones_impl.hpp"
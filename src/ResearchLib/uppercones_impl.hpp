@@ -0,0 +1,58 @@
+#pragma once
+
+#include <iostream>
+#include <vector>
+#include "OMtools.hpp"
+#include "research_file_template.hpp"
+#include "uppercones.hpp"
+#include "verboseness.hpp"
+
+namespace research {
+
+// The search for the chirotopes above `bottom`: its bases are fixed,
+// and every other `R`-tuple gets its own variable.
+template<int R, int N>
+SignAssignmentSearch<R, N> _upper_cone_search(const Chirotope<R, N>& bottom) {
+    SignAssignmentSearch<R, N> search;
+    for (int b = 0; b < SignAssignmentSearch<R, N>::NR; ++b) {
+        if (bottom.is_basis(b)) search.fix(b, bottom.evaluate(b));
+        else search.tie(b, search.add_variable());
+    }
+    return search;
+}
+
+template<int R, int N, typename Callback>
+void for_each_in_upper_cone(
+    const Chirotope<R, N>& bottom,
+    Callback&& callback,
+    unsigned nr_threads
+) {
+    auto search = _upper_cone_search(bottom);
+    search.for_each_chirotope([&](unsigned, const Chirotope<R, N>& chi) {
+        if (chi != bottom) callback(chi);
+    }, nr_threads);
+}
+
+template<int R, int N>
+std::vector<std::vector<Chirotope<R, N>>> generate_upper_cone(
+    const Chirotope<R, N>& bottom,
+    enum verboseness verbose,
+    unsigned nr_threads
+) {
+    if (verbose >= verboseness::info) {
+        report() << "Generating upper cone of " << bottom << "...\n";
+    }
+    auto search = _upper_cone_search(bottom);
+    auto upper_cone = search.chirotopes_by_basecount(nr_threads);
+    auto& same_basecount = upper_cone[bottom.countbases() - 1];
+    std::erase(same_basecount, bottom);
+    if (verbose >= verboseness::result) {
+        size_t total = 0;
+        for (const auto& chirotopes : upper_cone) total += chirotopes.size();
+        report() << "The upper cone of " << bottom << " contains " 
+        << total << " chirotopes.\n";
+    }
+    return upper_cone;
+}
+
+}
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <iostream>
+
 // Describes how verbose a certain program (or complicated
 // function) should be while it is running.
 //
@@ -12,4 +14,28 @@
 // - `checkpoints` means that the program should additionally
 //      print a progress report on its main tasks, so it is clear
 //      it is not stuck.
-enum verboseness {silent, result, info, checkpoints};
\ No newline at end of file
+enum verboseness {silent, result, info, checkpoints};
+
+// The stream to which research functions print their reports on the
+// current thread. It is `std::cout`, unless redirected by a
+// `RedirectReports`, which lets parallel programs collect the reports
+// of each task separately and print them in order.
+inline thread_local std::ostream* report_stream = &std::cout;
+
+// Returns the stream to which reports are printed on this thread.
+inline std::ostream& report()
+{ return *report_stream; }
+
+// Redirects the reports printed on the current thread to the given
+// stream while it is alive.
+class RedirectReports {
+public:
+    RedirectReports(std::ostream& stream): previous(report_stream)
+    { report_stream = &stream; }
+    ~RedirectReports()
+    { report_stream = previous; }
+    RedirectReports(const RedirectReports&) = delete;
+    RedirectReports& operator=(const RedirectReports&) = delete;
+private:
+    std::ostream* previous;
+};
\ No newline at end of file
@@ -18,12 +18,24 @@ namespace research {
 // if all weak insertion problems like above are abstractly solvable.
 // See other overloads of this functions, where this argument is replaced
 // by more concrete parameters.
+//
+// The cheap isolation check is done for all elements first. The
+// abstract solvability check is then done for the non-isolated
+// elements, ordered by the number of cocircuits of `chi` constraining
+// them (fewest first, ties broken by label), and the first one in this
+// order for which it succeeds is returned. With `nr_threads > 1`, the
+// checks of several elements run speculatively at once, and those
+// ranked after an element which already succeeded are not started, so
+// `check_abstractly_solvability` must then be safe to call from several
+// threads for distinct elements. The result does not depend on
+// `nr_threads`.
 template<int R, int N,
 std::invocable<const Chirotope<R, N>&, int, enum verboseness> Function>
 int _weakly_reducible_by(
     const Chirotope<R, N>& chi,
     Function check_abstractly_solvability,
-    enum verboseness verbose = verboseness::result
+    enum verboseness verbose = verboseness::result,
+    unsigned nr_threads = 1
 );
 
 // Find an element `e` of the oriented matroid `chi` satisfying the
@@ -44,20 +56,17 @@ int weakly_reducible_by(
     const Chirotope<R, N>& chi,
     const std::vector<Chirotope<R, N>>& lower_cone_of_chi,
     const std::vector<std::vector<Matroid<R, N>>>& matroids_to_filter_deletion_with,
-    enum verboseness verbose = verboseness::result
+    enum verboseness verbose = verboseness::result,
+    unsigned nr_threads = 1
 ) {
+    AbstractSolvabilityContext<R, N> context(chi, lower_cone_of_chi, matroids_to_filter_deletion_with);
     return _weakly_reducible_by(
         chi,
-        [&] (const Chirotope<R, N>& c, int e, enum verboseness v) {
-            return is_always_abstractly_solvabe(
-                c,
-                e,
-                lower_cone_of_chi,
-                matroids_to_filter_deletion_with,
-                v
-            );
+        [&] (const Chirotope<R, N>&, int e, enum verboseness v) {
+            return context.is_always_abstractly_solvable(e, v);
         },
-        verbose
+        verbose,
+        nr_threads
     );
 }
 
@@ -65,25 +74,24 @@ int weakly_reducible_by(
 // but some input variables are computed automatically.
 // `matroids` must contain all matroids with at least
 // `minimum_N_for_not_abstractly_solvable<R>` many nonloops.
+// The lower cone of `chi` is only computed once, when the first
+// element passes the isolation check.
 template<int R, int N>
 int weakly_reducible_by(
     const Chirotope<R, N>& chi,
     const std::vector<std::vector<Matroid<R, N>>>& matroids,
     const std::vector<std::vector<Matroid<R, N>>>& matroids_to_filter_deletion_with,
-    enum verboseness verbose = verboseness::result
+    enum verboseness verbose = verboseness::result,
+    unsigned nr_threads = 1
 ) {
+    AbstractSolvabilityContext<R, N> context(chi, matroids, matroids_to_filter_deletion_with);
     return _weakly_reducible_by(
         chi,
-        [&] (const Chirotope<R, N>& c, int e, enum verboseness v) {
-            return is_always_abstractly_solvabe(
-                c,
-                e,
-                matroids,
-                matroids_to_filter_deletion_with,
-                v
-            );
+        [&] (const Chirotope<R, N>&, int e, enum verboseness v) {
+            return context.is_always_abstractly_solvable(e, v);
         },
-        verbose
+        verbose,
+        nr_threads
     );
 }
 
@@ -95,16 +103,10 @@ int weakly_reducible_by(
     const std::vector<std::vector<Matroid<R, N>>>& matroids_to_filter_deletion_with,
     enum verboseness verbose = verboseness::result
 ) {
-    return _weakly_reducible_by(
+    return weakly_reducible_by(
         chi,
-        [&] (const Chirotope<R, N>& c, int e, enum verboseness v) {
-            return is_always_abstractly_solvabe(
-                c,
-                e,
-                matroids_to_filter_deletion_with,
-                v
-            );
-        },
+        matroids_to_filter_deletion_with,
+        matroids_to_filter_deletion_with,
         verbose
     );
 }
@@ -114,9 +116,13 @@ int weakly_reducible_by(
     const Chirotope<R, N>& chi,
     enum verboseness verbose = verboseness::result
 ) {
-    return _weakly_reducible_by(
+    auto matroids_to_filter_deletion_with = matroids_with_few_loops<R, N>(
+        N + 1 - minimum_N_for_not_abstractly_solvable<R>,
+        verboseness::silent
+    );
+    return weakly_reducible_by(
         chi,
-        is_always_abstractly_solvabe<R, N>,
+        matroids_to_filter_deletion_with,
         verbose
     );
 }
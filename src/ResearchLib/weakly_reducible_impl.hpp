@@ -1,11 +1,15 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <concepts>
 #include <iostream>
 #include <vector>
 #include "OMtools.hpp"
 #include "abstractly_solvable.hpp"
 #include "isolation.hpp"
+#include "verboseness.hpp"
 #include "moreRtuples.hpp"
 #include "program_utility.hpp"
 #include "research_file_template.hpp"
@@ -20,32 +24,32 @@ std::invocable<const Chirotope<R, N>&, int, enum verboseness> Function>
 int _weakly_reducible_by(
     const Chirotope<R, N>& chi,
     Function check_abstractly_solvability,
-    enum verboseness verbose
+    enum verboseness verbose,
+    unsigned nr_threads
 ) {
     // Start announcement
     if (verbose >= verboseness::info) {
-        std::cout << "Looking for an element by which the target chirotope  " << chi 
+        report() << "Looking for an element by which the target chirotope  " << chi 
         << " is weakly reducible, i.e. all weak insertion problems are non-isolated "
         "and abstractly solvable...\n";
     }
     // Quick setup
-    auto cocircuits = OM_operations::cocircuits(chi);
     int loopcount_chi = chi.loopcount();
-    std::array<sign_vector_operations::Multiply_P0<Chirotope<R, N>>,N> deleters;
     std::vector<bool> not_loop_in_chi;
     for (int e = 0; e < N; ++e) {
-        deleters[e] = OM_operations::delete_element<R, N>(e);
         not_loop_in_chi.push_back(!chi.is_loop(e));
     }
-    // Check each element if chi can be weakly reduced by it
+    // The same deletions are tested for many elements.
+    DeletionCache<R, N> deletions(chi);
+    // Check each element for isolatedness, which is cheap
+    std::vector<int> candidates;
     for (int e = 0; e < N; ++e) {
         if (chi.is_loop(e)) {
             if (verbose >= verboseness::info) {
-                std::cout << "- element " << e << " is a loop\n";
+                report() << "- element " << e << " is a loop\n";
             }
             continue;
         }
-        // Test isolatedness
         bool nonisolated_in_all_relevant_deletions = true;
         not_loop_in_chi[e] = false; // see reason 4 lines below
         for (int nr_to_delete = 0; 
@@ -53,20 +57,23 @@ int _weakly_reducible_by(
             && nonisolated_in_all_relevant_deletions; 
         ++nr_to_delete) {
             for (auto to_delete: research::tuple_iterator_on_subset(nr_to_delete,N,not_loop_in_chi)) {
-                Chirotope<R, N> deletion = chi;
+                uint32_t deleted = 0;
                 for (int element_to_delete: to_delete) {
-                    deletion = deleters[element_to_delete](deletion);
+                    deleted |= uint32_t(1) << element_to_delete;
                 }
-                auto cocircuits_of_deletion = OM_operations::cocircuits(deletion);
+                auto& deletion = deletions.deletion(deleted);
                 if (research::is_isolated(
-                    deletion, 
-                    cocircuits_of_deletion,
+                    deletion.chirotope, 
+                    deletion.cocircuits,
+                    deletion.constrains_table,
                     e
                 )) {
                     if (verbose >= verboseness::info) {
-                        std::cout << "- element " << e << " is isolated in M\\{";
-                        programs::utility::print_comma_separated_iterable_of_ints(to_delete);
-                        std::cout << "} = " << deletion << "\n";
+                        report() << "- element " << e << " is isolated in M\\{";
+                        programs::utility::print_comma_separated_iterable_of_ints(
+                            to_delete, 3, report()
+                        );
+                        report() << "} = " << deletion.chirotope << "\n";
                     }
                     nonisolated_in_all_relevant_deletions = false;
                     break;
@@ -76,23 +83,48 @@ int _weakly_reducible_by(
         not_loop_in_chi[e] = true;
         if (!nonisolated_in_all_relevant_deletions) continue;
         if (verbose >= verboseness::info) {
-            std::cout << "- element " << e << " is NOT isolated!\n";
+            report() << "- element " << e << " is NOT isolated!\n";
         }
-        // Set up abstractly solvability check
-        if (check_abstractly_solvability(
+        candidates.push_back(e);
+    }
+    // Elements constrained by fewer cocircuits of `chi` are more often
+    // abstractly solvable, so they are tried first.
+    const auto& without_deletion = deletions.deletion(0);
+    std::array<int, N> nr_constraining;
+    for (int e: candidates) {
+        nr_constraining[e] = 0;
+        for (size_t j = 0; j < without_deletion.cocircuits.size(); ++j) {
+            nr_constraining[e] += without_deletion.constrains_table(j, e);
+        }
+    }
+    std::stable_sort(candidates.begin(), candidates.end(), [&](int e, int f) {
+        return nr_constraining[e] < nr_constraining[f];
+    });
+    // Check abstract solvability in this order, skipping every candidate
+    // ranked after one which already succeeded
+    std::atomic<size_t> rank_of_success{candidates.size()};
+    parallel::for_each_index_with_ordered_output(0, candidates.size(),
+    [&](size_t rank, std::ostream& log) {
+        if (rank > rank_of_success.load()) return;
+        RedirectReports redirect(log);
+        if (!check_abstractly_solvability(
             chi,
-            e,
+            candidates[rank],
             std::min(verbose, verboseness::result)
-        )) {
-            if (verbose >= verboseness::result) {
-                std::cout << "          and non-isolated, therefore M is weakly reducible by "
-                << e << ".\n";
-            }
-            return e;
+        )) return;
+        size_t best = rank_of_success.load();
+        while (rank < best && !rank_of_success.compare_exchange_weak(best, rank));
+    }, report(), nr_threads);
+    if (rank_of_success.load() < candidates.size()) {
+        int e = candidates[rank_of_success.load()];
+        if (verbose >= verboseness::result) {
+            report() << "          and non-isolated, therefore M is weakly reducible by "
+            << e << ".\n";
         }
+        return e;
     }
     if (verbose >= verboseness::result) {
-        std::cout << "[FAILURE] The chirotope " << chi << " is not weakly reducible "
+        report() << "[FAILURE] The chirotope " << chi << " is not weakly reducible "
         "by any element.\n\n";
     }
     return -1;
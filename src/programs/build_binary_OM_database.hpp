@@ -0,0 +1,83 @@
+#pragma once
+
+#include <string>
+#include <iostream>
+#include <filesystem>
+#include <mutex>
+#include <unordered_map>
+#include "OMtools.hpp"
+#include "researchlib.hpp"
+#include "read_Finschi.hpp"
+#include "program_template.hpp"
+
+namespace programs {
+
+// Builds a binary database (see `BinaryOMDatabaseWriter`) of all
+// oriented matroids of rank `R` on `N` elements, one chirotope of each,
+// replacing the program `find_all_OMs.c` which produced the text
+// databases.
+//
+// Finschi's lists of non-uniform representatives only contain simple
+// oriented matroids, so, as in `find_all_OMs.c`, representatives are
+// taken from the lower cones of the uniform representatives instead:
+// each lower cone is enumerated by a `SignAssignmentSearch`, and its
+// elements are deduplicated by their canonical forms. This finds every
+// oriented matroid which is a weak map image of a uniform one, which in
+// rank 3 is all of them. In higher ranks there are oriented matroids
+// which are not weak map images of uniform ones, so the database may be
+// incomplete, and a warning is printed. The orbits of the
+// representatives are then expanded and written to the database.
+//
+// The lists of uniform representatives must be present among the
+// resources: for example `r4n8` is not, so it must be added there before
+// the rank 4 database on 8 elements can be built.
+template<int R, int N>
+int build_binary_OM_database_from_Finschi_representatives(
+    std::string (*path_of)(int) = &database_names::binary_OM_set<R, N>
+)
+{
+using SEARCH = SignAssignmentSearch<R, N>;
+if constexpr (R != 3) {
+    std::cout << "Warning: in rank " << R << " not every oriented matroid is a weak map "
+    << "image of a uniform one, so the database may be incomplete.\n";
+}
+auto uniform_representatives = OMexamples::read_uniform_Finschi_representatives<R, N>();
+if (uniform_representatives.empty()) {
+    std::cout << "Could not read any uniform representatives from "
+    << database_names::uniform_Finschi<R, N> << ".\n";
+    return 1;
+}
+std::cout << "Read " << uniform_representatives.size() << " uniform representatives.\n";
+
+// Canonical forms of all OMs found so far, and the first OM found
+// with each canonical form.
+std::unordered_map<Chirotope<R, N>, Chirotope<R, N>> representative_of_class;
+std::mutex mutex;
+for (size_t idx = 0; idx < uniform_representatives.size(); ++idx) {
+    const auto& top = uniform_representatives[idx];
+    SEARCH search;
+    for (int b = 0; b < SEARCH::NR; ++b) {
+        search.tie(b, search.add_variable(
+            SEARCH::ZERO | (top.get_plus(b) ? SEARCH::PLUS : SEARCH::MINUS)
+        ));
+    }
+    search.for_each_chirotope([&](unsigned, const Chirotope<R, N>& chi) {
+        if (chi.is_zero()) return;
+        auto canonical = OM_operations::canonical_form(chi).chirotope;
+        std::lock_guard<std::mutex> lock(mutex);
+        representative_of_class.emplace(canonical, chi);
+    });
+    std::cout << "[" << idx + 1 << "/" << uniform_representatives.size() << "] "
+    << representative_of_class.size() << " isomorphism classes found so far.\n";
+}
+
+ChirotopeArray<R, N> representatives;
+for (const auto& [canonical, chi]: representative_of_class) representatives.push_back(chi);
+std::filesystem::create_directories(std::filesystem::path(path_of(1)).parent_path());
+auto total = OM_operations::write_orbits_to_binary_database(representatives, path_of);
+std::cout << "Wrote " << total << " oriented matroids in " << representatives.size()
+<< " isomorphism classes to the binary database.\n";
+return 0;
+}
+
+}
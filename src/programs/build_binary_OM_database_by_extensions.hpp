@@ -0,0 +1,46 @@
+#pragma once
+
+#include <string>
+#include <iostream>
+#include <filesystem>
+#include "OMtools.hpp"
+#include "researchlib.hpp"
+#include "program_template.hpp"
+
+namespace programs {
+
+// Builds a binary database (see `BinaryOMDatabaseWriter`) of all
+// oriented matroids of rank `R` on `N` elements from the binary database
+// of those on `N-1` elements, without Finschi's lists of representatives:
+// one representative of every isomorphism class on `N-1` elements is
+// chosen, their single element extensions are enumerated in parallel
+// and deduplicated by their canonical forms, and the orbits of the
+// resulting representatives are written to the database.
+template<int R, int N>
+int build_binary_OM_database_by_extensions(
+    std::string (*input_path_of)(int) = &database_names::binary_OM_set<R, N - 1>,
+    std::string (*path_of)(int) = &database_names::binary_OM_set<R, N>
+)
+{
+ChirotopeArray<R, N - 1> smaller_OMs;
+for (const auto& chis : read_binary_OM_database<R, N - 1>(input_path_of)) {
+    smaller_OMs.insert(smaller_OMs.end(), chis.begin(), chis.end());
+}
+if (smaller_OMs.empty()) {
+    std::cout << "Could not read any oriented matroids on " << N - 1 << " elements.\n";
+    return 1;
+}
+auto smaller_representatives = OM_operations::remove_isomorphic_duplicates(smaller_OMs);
+std::cout << "Read " << smaller_OMs.size() << " oriented matroids on " << N - 1
+<< " elements in " << smaller_representatives.size() << " isomorphism classes.\n";
+
+auto representatives = OM_operations::extension_representatives(smaller_representatives);
+std::cout << "Found " << representatives.size() << " isomorphism classes on "
+<< N << " elements.\n";
+std::filesystem::create_directories(std::filesystem::path(path_of(1)).parent_path());
+auto total = OM_operations::write_orbits_to_binary_database(representatives, path_of);
+std::cout << "Wrote " << total << " oriented matroids to the binary database.\n";
+return 0;
+}
+
+}
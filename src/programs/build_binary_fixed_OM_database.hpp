@@ -0,0 +1,44 @@
+#pragma once
+
+#include <string>
+#include <iostream>
+#include <filesystem>
+#include "OMtools.hpp"
+#include "researchlib.hpp"
+#include "program_template.hpp"
+
+namespace programs {
+
+// Builds a binary database (see `BinaryOMDatabaseWriter`) of the
+// oriented matroids of rank `R` on `N` elements which are fixed by the
+// given group, one chirotope of each, replacing the programs
+// `construct_fixed_OMs.c`, `short_l.c` and `longer_l.c`. For example,
+// the oriented matroids of rank 3 on 9 elements fixed by `Z_3+Z_3` are
+// found by
+//
+//   programs::build_binary_fixed_OM_database<3, 9>(
+//       PermutationGroup<9>::cyclic_product(3, 3),
+//       [](int n_bases) { return database_names::binary_fixed_OM_set<3, 9>("Z3+Z3", n_bases); }
+//   );
+//
+// Returns 1 if the group has 32 or more generators.
+template<int R, int N>
+int build_binary_fixed_OM_database(const PermutationGroup<N>& group, std::string (*path_of)(int))
+{
+const size_t k = group.generators().size();
+std::cout << "The group has order " << group.order() << " and " << k << " generators.\n";
+if (k >= 32) {
+    std::cout << "Characters are stored as 32-bit masks, so the group must have fewer than 32 generators.\n";
+    return 1;
+}
+for (uint32_t character = 0; character < (uint32_t(1) << k); ++character) {
+    std::cout << "Character " << character << ": "
+    << OM_operations::BasisOrbits<R, N>(group, character).size << " basis orbits.\n";
+}
+std::filesystem::create_directories(std::filesystem::path(path_of(1)).parent_path());
+auto total = OM_operations::write_fixed_chirotopes_to_binary_database<R, N>(group, path_of);
+std::cout << "Wrote " << total << " fixed oriented matroids to the binary database.\n";
+return 0;
+}
+
+}
@@ -0,0 +1,258 @@
+#pragma once
+
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace programs {
+
+// The first integer of every checkpoint log (see `CheckpointLog`).
+constexpr uint32_t CHECKPOINT_LOG_MAGIC = 0x54504b43; // "CKPT"
+
+// The programs writing checkpoint logs. Each has its own id, so that a
+// log is never mistaken for one of another program with the same
+// `Record` type and parameters.
+enum checkpoint_program {
+    PROVE_R3N7 = 1,
+    PROVE_CONJECTURE = 2,
+    EULER_CHAR_OF_LOWERCONES = 3
+};
+
+// Returns the tag of the checkpoint log of the given program, run with
+// parameters `R` and `N`.
+constexpr uint32_t checkpoint_tag(checkpoint_program program, int R, int N) {
+    return ((uint32_t)program << 16) | ((uint32_t)R << 8) | (uint32_t)N;
+}
+
+// An append-only binary log of the results of the targets of a long
+// program (e.g. the element by which a chirotope is weakly reducible,
+// or its face vector), so that a restarted program can skip the
+// targets it already completed.
+//
+// The file starts with three 32-bit unsigned integers (in the byte
+// order of the machine): `CHECKPOINT_LOG_MAGIC`, `sizeof(Record)` and a
+// `tag` telling apart logs of different programs and parameters (see
+// `checkpoint_tag`). Each entry is the index of the target as a 64-bit
+// unsigned integer, the bytes of the result, and a 32-bit FNV-1a
+// checksum of both. An entry torn by a crash either fails its checksum
+// or is cut short by the end of the file, and is cut off together with
+// everything after it when the log is reopened. Errors while reading
+// the log throw instead, so that they never cut off valid entries.
+//
+// Results are buffered, and written and flushed to the disk with
+// `fsync` once `sync_every` of them are pending, by `sync()`, and on
+// destruction. A crash therefore loses at most the last `sync_every`
+// results, while the cost of a record stays a copy into the buffer.
+// All member functions are safe to call from several threads at once.
+template<typename Record>
+class CheckpointLog {
+    static_assert(std::is_trivially_copyable_v<Record>,
+    "Results are stored as raw bytes.");
+public:
+    // Opens the log at `path`, creating it if it does not exist, and
+    // reads the results recorded so far. If `path` is empty, nothing is
+    // stored on the disk. Throws `std::runtime_error` if the file cannot
+    // be opened or read, or was written with another `Record` size or
+    // `tag`.
+    CheckpointLog(const std::string& path, uint32_t tag = 0, size_t sync_every = 64);
+    CheckpointLog(const CheckpointLog&) = delete;
+    ~CheckpointLog();
+
+    // Returns whether a result was recorded for the given target.
+    bool is_done(size_t target) const;
+    // Returns the result recorded for the given target, which must be done.
+    Record result(size_t target) const;
+    // Returns the number of targets with a recorded result.
+    size_t number_of_results() const;
+    // Records the result of the given target.
+    void record(size_t target, const Record&);
+    // Writes the pending results, and waits until they reach the disk.
+    // Throws `std::runtime_error` if this fails, and then the results
+    // which were not written stay pending for the next attempt.
+    void sync();
+
+private:
+    constexpr static const size_t ENTRY_SIZE = sizeof(uint64_t) + sizeof(Record) + sizeof(uint32_t);
+
+    int file = -1;
+    size_t sync_every;
+    std::unordered_map<uint64_t, Record> results;
+    std::vector<char> pending;
+    mutable std::mutex mutex;
+
+    static uint32_t checksum(const char* bytes, size_t size);
+    // Reads up to `size` bytes, stopping early only at the end of the
+    // file, and retrying reads interrupted by signals. Returns the number
+    // of bytes read, or -1 on any other error.
+    static ssize_t read_fully(int file, char* bytes, size_t size);
+    void write_pending();
+};
+
+template<typename Record>
+uint32_t CheckpointLog<Record>::checksum(const char* bytes, size_t size) {
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= (unsigned char)bytes[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+template<typename Record>
+ssize_t CheckpointLog<Record>::read_fully(int file, char* bytes, size_t size) {
+    size_t filled = 0;
+    while (filled < size) {
+        ssize_t nr_read = ::read(file, bytes + filled, size - filled);
+        if (nr_read < 0 && errno == EINTR) continue;
+        if (nr_read < 0) return -1;
+        if (nr_read == 0) break;
+        filled += nr_read;
+    }
+    return filled;
+}
+
+template<typename Record>
+CheckpointLog<Record>::CheckpointLog(const std::string& path, uint32_t tag, size_t sync_every):
+sync_every(sync_every == 0 ? 1 : sync_every) {
+    if (path.empty()) return;
+    file = ::open(path.c_str(), O_RDWR | O_CREAT, 0644);
+    if (file < 0) throw std::runtime_error("Could not open the checkpoint log " + path + ".");
+    const uint32_t header[3] = {CHECKPOINT_LOG_MAGIC, (uint32_t)sizeof(Record), tag};
+    uint32_t existing_header[3];
+    auto fail = [&](const std::string& message) {
+        ::close(file);
+        file = -1;
+        throw std::runtime_error(message);
+    };
+    ssize_t header_size = read_fully(file, (char*)existing_header, sizeof(existing_header));
+    if (header_size < 0) fail("Could not read the checkpoint log " + path + ".");
+    if (header_size < (ssize_t)sizeof(header)) {
+        // A new log, or one whose header was torn.
+        if (::ftruncate(file, 0) != 0 || ::lseek(file, 0, SEEK_SET) != 0 
+        || ::write(file, header, sizeof(header)) != (ssize_t)sizeof(header)) {
+            fail("Could not write the checkpoint log " + path + ".");
+        }
+        if (::fsync(file) != 0) fail("Could not flush the checkpoint log " + path + ".");
+        return;
+    }
+    if (std::memcmp(header, existing_header, sizeof(header))) {
+        fail("The checkpoint log " + path + " belongs to another program.");
+    }
+    // Read the entries until the end, or until the first torn one.
+    off_t valid_end = sizeof(header);
+    std::vector<char> buffer(ENTRY_SIZE * 4096);
+    size_t filled = 0;
+    bool is_torn = false;
+    while (true) {
+        ssize_t nr_read = read_fully(file, buffer.data() + filled, buffer.size() - filled);
+        if (nr_read < 0) fail("Could not read the checkpoint log " + path + ".");
+        bool is_at_end = filled + nr_read < buffer.size();
+        filled += nr_read;
+        size_t start = 0;
+        for (; start + ENTRY_SIZE <= filled; start += ENTRY_SIZE) {
+            const char* entry = buffer.data() + start;
+            uint32_t stored_checksum;
+            std::memcpy(&stored_checksum, entry + ENTRY_SIZE - sizeof(uint32_t), sizeof(uint32_t));
+            if (stored_checksum != checksum(entry, ENTRY_SIZE - sizeof(uint32_t))) {
+                is_torn = true;
+                break;
+            }
+            uint64_t target;
+            Record result;
+            std::memcpy(&target, entry, sizeof(uint64_t));
+            std::memcpy(&result, entry + sizeof(uint64_t), sizeof(Record));
+            results[target] = result;
+            valid_end += ENTRY_SIZE;
+        }
+        if (is_torn || is_at_end) {
+            // A partial entry left at the end of the file is torn too.
+            is_torn = is_torn || start < filled;
+            break;
+        }
+        std::memmove(buffer.data(), buffer.data() + start, filled - start);
+        filled -= start;
+    }
+    if ((is_torn && ::ftruncate(file, valid_end) != 0) || ::lseek(file, valid_end, SEEK_SET) != valid_end) {
+        fail("Could not repair the checkpoint log " + path + ".");
+    }
+}
+
+template<typename Record>
+CheckpointLog<Record>::~CheckpointLog() {
+    if (file < 0) return;
+    try {
+        sync();
+    } catch (const std::runtime_error&) {
+        // The pending results are lost, like on a crash.
+    }
+    ::close(file);
+}
+
+template<typename Record>
+bool CheckpointLog<Record>::is_done(size_t target) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return results.contains(target);
+}
+
+template<typename Record>
+Record CheckpointLog<Record>::result(size_t target) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return results.at(target);
+}
+
+template<typename Record>
+size_t CheckpointLog<Record>::number_of_results() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return results.size();
+}
+
+template<typename Record>
+void CheckpointLog<Record>::record(size_t target, const Record& result) {
+    std::lock_guard<std::mutex> lock(mutex);
+    results[target] = result;
+    if (file < 0) return;
+    size_t start = pending.size();
+    pending.resize(start + ENTRY_SIZE);
+    char* entry = pending.data() + start;
+    uint64_t target64 = target;
+    std::memcpy(entry, &target64, sizeof(uint64_t));
+    std::memcpy(entry + sizeof(uint64_t), &result, sizeof(Record));
+    uint32_t entry_checksum = checksum(entry, ENTRY_SIZE - sizeof(uint32_t));
+    std::memcpy(entry + ENTRY_SIZE - sizeof(uint32_t), &entry_checksum, sizeof(uint32_t));
+    if (pending.size() >= sync_every * ENTRY_SIZE) write_pending();
+}
+
+template<typename Record>
+void CheckpointLog<Record>::sync() {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (file >= 0) write_pending();
+}
+
+template<typename Record>
+void CheckpointLog<Record>::write_pending() {
+    size_t written = 0;
+    while (written < pending.size()) {
+        ssize_t nr_written = ::write(file, pending.data() + written, pending.size() - written);
+        if (nr_written < 0 && errno == EINTR) continue;
+        if (nr_written <= 0) {
+            // The written bytes are on the disk, so only the rest is
+            // written by the next attempt, which keeps the entries
+            // aligned.
+            pending.erase(pending.begin(), pending.begin() + written);
+            throw std::runtime_error("Could not write the checkpoint log.");
+        }
+        written += nr_written;
+    }
+    pending.clear();
+    if (::fsync(file) != 0) throw std::runtime_error("Could not flush the checkpoint log.");
+}
+
+}
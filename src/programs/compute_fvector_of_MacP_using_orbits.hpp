@@ -0,0 +1,63 @@
+#pragma once
+
+#include <iostream>
+#include <vector>
+#include <array>
+#include "OMtools.hpp"
+#include "researchlib.hpp"
+#include "program_template.hpp"
+
+namespace programs {
+
+// Computes the f-vector of `MacP(R,N)`, and the Euler characteristics
+// of the lower cones of all oriented matroids, like
+// `compute_fvector_of_MacP_using_database`, but only from Finschi's
+// list of uniform representatives: the computation runs on one
+// oriented matroid of each isomorphism class (see `OrbitPoset`), and
+// the counts are weighted by the sizes of the orbits. In rank 3 every
+// oriented matroid is a weak map image of a uniform one, so this gives
+// all of `MacP(3,N)`.
+template<int R, int N>
+int compute_fvector_of_MacP_using_orbits()
+{
+constexpr int NR = binomial_coefficient(N, R);
+auto uniform_representatives = OMexamples::read_uniform_Finschi_representatives<R, N>();
+if (uniform_representatives.empty()) {
+    std::cout << "Could not read any uniform representatives from "
+    << database_names::uniform_Finschi<R, N> << ".\n";
+    return 1;
+}
+OrbitPoset<R, N> poset(uniform_representatives);
+std::cout << "Found " << poset.number_of_OMs() << " oriented matroids in "
+<< poset.size() << " isomorphism classes.\n";
+
+auto lower_cone_face_vectors = poset.template lower_cone_face_vectors<NR>();
+uint64_t total_OMs_with_non_1_ec = 0;
+for (int b = 1; b <= NR; ++b) {
+    size_t classes_with_non_1_ec = 0;
+    uint64_t OMs = 0, OMs_with_non_1_ec = 0;
+    for (auto idx = poset.level_start[b]; idx < poset.level_start[b + 1]; ++idx) {
+        OMs += poset.orbit_sizes[idx];
+        if (euler_characteristic<NR>(lower_cone_face_vectors[idx]) == 1) continue;
+        ++classes_with_non_1_ec;
+        OMs_with_non_1_ec += poset.orbit_sizes[idx];
+    }
+    std::cout << "Finished OMs with " << b << " bases. There were "
+    << OMs_with_non_1_ec << "/" << OMs << " many of them (in "
+    << classes_with_non_1_ec << "/" << poset.level_start[b + 1] - poset.level_start[b]
+    << " classes) with non-1 Euler-characteristic.\n";
+    total_OMs_with_non_1_ec += OMs_with_non_1_ec;
+}
+std::cout << "There were " << total_OMs_with_non_1_ec << "/" << poset.number_of_OMs()
+<< " many non-1 Euler characteristic lower cones.\n";
+
+auto f = poset.template face_vector<NR>(lower_cone_face_vectors);
+std::cout << "Total f-vector: (" << f[0];
+for (auto d = 1; d < NR; d++) {
+    std::cout << ", " << f[d];
+}
+std::cout << ")\n";
+return 0;
+}
+
+}
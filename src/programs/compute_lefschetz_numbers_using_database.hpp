@@ -0,0 +1,56 @@
+#pragma once
+
+#include <iostream>
+#include <vector>
+#include "OMtools.hpp"
+#include "researchlib.hpp"
+#include "program_template.hpp"
+
+namespace programs {
+
+// Using a precomputed database of all oriented matroids of a given
+// rank and number of elements, compute the Lefschetz number of every
+// element of `group` acting on `MacP(R,N)` by relabeling, i.e. the
+// Euler characteristic of the subposet of fixed oriented matroids (see
+// `equivariant_data`). The database is read once, and each group
+// element only compares and sweeps its fixed subposet. The Euler
+// characteristic of the quotient by the group, which is the average of
+// the Lefschetz numbers, is also printed.
+//
+// If `cones_of` is not empty, the Lefschetz numbers of the action of
+// each element on the lower and upper cones of these oriented
+// matroids are printed as well (when they are fixed by the element).
+template<int R, int N>
+int compute_lefschetz_numbers_using_database(
+    const PermutationGroup<N>& group,
+    const std::vector<Chirotope<R, N>>& cones_of = {}
+)
+{
+static_assert((R == 3 && N == 6) || (R == 3 && N == 7),
+"This program must be compiled with parameters (3,6) or (3,7)!");
+constexpr int NR = binomial_coefficient(N, R);
+auto data = equivariant_data<NR>(research::read_OMs<R, N>(verboseness::result), group);
+std::cout << "Computed the fixed subposets of all " << data.size() << " group elements.\n\n";
+
+long long sum_of_lefschetz_numbers = 0;
+for (const auto& entry : data) {
+    std::cout << "Permutation (";
+    for (int e = 0; e < N; ++e) std::cout << (e ? " " : "") << entry.permutation[e];
+    std::cout << "): " << entry.fixed_elements.size() << " fixed OMs, Lefschetz number "
+        << entry.lefschetz_number << ".\n";
+    sum_of_lefschetz_numbers += entry.lefschetz_number;
+    for (const auto& chi : cones_of) {
+        for (size_t i = 0; i < entry.fixed_elements.size(); ++i) {
+            const auto& element = entry.fixed_elements[i];
+            if (element != chi && element != chi.inverse()) continue;
+            std::cout << "    " << chi << ": lower cone " << entry.lower_cone_lefschetz_numbers[i]
+                << ", upper cone " << entry.upper_cone_lefschetz_numbers[i] << ".\n";
+        }
+    }
+}
+std::cout << "\nEuler characteristic of the quotient: "
+    << sum_of_lefschetz_numbers << "/" << data.size() << ".\n";
+return 0;
+}
+
+}
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <string>
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <array>
+#include "OMtools.hpp"
+#include "researchlib.hpp"
+#include "program_template.hpp"
+#include "euler_char_of_lowercones.hpp"
+
+namespace programs {
+
+// Using a precomputed database of all oriented matroids of a given
+// rank and number of elements, compute the face vectors and Euler
+// characteristics of both the strict lower cone and the strict upper
+// cone of every oriented matroid. The database is read once, and the
+// cones are obtained in one upward and one downward sweep over the
+// basecounts. The comparabilities are not stored, since for `(3,7)`
+// they would not fit in memory, so each sweep compares the chirotopes
+// again.
+//
+// The results are written to `output_path` as a table: after a header
+// line naming the columns, each line describes one oriented matroid by
+// its basecount, chirotope, the Euler characteristics of its lower and
+// upper cones, and then the entries of the two face vectors (up to the
+// largest dimension occurring in the poset). The distributions of Euler
+// characteristics are also printed for each basecount. Returns 1 if
+// the table cannot be written.
+template<int R, int N>
+int compute_cone_statistics_using_database(
+    const std::string& output_path = database_names::cone_statistics<R, N>
+)
+{
+static_assert((R == 3 && N == 6) || (R == 3 && N == 7),
+"This program must be compiled with parameters (3,6) or (3,7)!");
+constexpr int NR = binomial_coefficient(N, R);
+OMPoset<R, N> poset(research::read_OMs<R, N>(verboseness::result));
+std::cout << "Compared all " << poset.size() << " OMs.\n";
+auto lower_fvs = poset.template lower_cone_face_vectors<NR>();
+std::cout << "Computed the face vectors of all lower cones.\n";
+auto upper_fvs = poset.template upper_cone_face_vectors<NR>();
+std::cout << "Computed the face vectors of all upper cones.\n\n";
+
+// Only print as many dimensions as there are in the poset.
+int nr_of_dimensions = 0;
+for (int b = 1; b <= NR; ++b) {
+    if (poset.level_start[b] != poset.level_start[b + 1]) ++nr_of_dimensions;
+}
+std::ofstream output(output_path);
+if (!output) {
+    std::cout << "Could not open " << output_path << " for writing.\n";
+    return 1;
+}
+output << "basecount chirotope lower_euler_char upper_euler_char";
+for (int d = 0; d < nr_of_dimensions; ++d) output << " lower_f" << d;
+for (int d = 0; d < nr_of_dimensions; ++d) output << " upper_f" << d;
+output << "\n";
+
+EulerCharAnalyzer lower_ec_analyzer;
+EulerCharAnalyzer upper_ec_analyzer;
+upper_ec_analyzer.these_are_ecs_of = "upper cones";
+for (int b = 1; b <= NR; ++b) {
+    if (poset.level_start[b] == poset.level_start[b + 1]) continue;
+    for (size_t idx = poset.level_start[b]; idx < poset.level_start[b + 1]; ++idx) {
+        auto lower_ec = euler_characteristic<NR>(lower_fvs[idx]);
+        auto upper_ec = euler_characteristic<NR>(upper_fvs[idx]);
+        lower_ec_analyzer.add_entry(lower_ec);
+        upper_ec_analyzer.add_entry(upper_ec);
+        output << b << " " << poset.elements[idx] << " " << lower_ec << " " << upper_ec;
+        for (int d = 0; d < nr_of_dimensions; ++d) output << " " << lower_fvs[idx][d];
+        for (int d = 0; d < nr_of_dimensions; ++d) output << " " << upper_fvs[idx][d];
+        output << "\n";
+    }
+    std::cout << "[" << b << "] OMs with " << b << " bases. ";
+    lower_ec_analyzer.end_batch();
+    std::cout << "[" << b << "] OMs with " << b << " bases. ";
+    upper_ec_analyzer.end_batch();
+}
+output.close();
+if (!output) {
+    std::cout << "Could not write the results to " << output_path << ".\n";
+    return 1;
+}
+std::cout << "The results were written to " << output_path << ".\n";
+return 0;
+}
+
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <iostream>
+#include <map>
+#include <vector>
+#include <array>
+#include "OMtools.hpp"
+#include "researchlib.hpp"
+#include "program_template.hpp"
+
+namespace programs {
+
+// Using a precomputed database of all oriented matroids of a given
+// rank and number of elements, count the covectors of each rank (see
+// `OM_operations::covectors_by_rank`) of every oriented matroid. For
+// each basecount, the distinct vectors of counts are printed together
+// with the number of oriented matroids having them; the last count is
+// the number of topes. The oriented matroids are distributed over
+// `nr_threads` threads.
+template<int R, int N>
+int compute_covector_statistics_using_database(
+    unsigned nr_threads = parallel::default_number_of_threads()
+)
+{
+static_assert((R == 3 && N == 6) || (R == 3 && N == 7),
+"This program must be compiled with parameters (3,6) or (3,7)!");
+const auto OMs_by_basecount = research::read_OMs<R, N>(verboseness::result);
+for (size_t b = 0; b < OMs_by_basecount.size(); ++b) {
+    const auto& OMs = OMs_by_basecount[b];
+    if (OMs.empty()) continue;
+    std::vector<std::array<size_t, R + 1>> counts(OMs.size());
+    parallel::for_each_index(0, OMs.size(), [&](size_t idx) {
+        counts[idx] = OM_operations::covector_counts(OMs[idx], 1);
+    }, nr_threads, 64);
+    std::map<std::array<size_t, R + 1>, size_t> distribution;
+    for (const auto& counts_of_OM : counts) ++distribution[counts_of_OM];
+    std::cout << "Basecount " << b + 1 << " (" << OMs.size() << " OMs):\n";
+    for (const auto& [counts_of_OMs, nr_OMs] : distribution) {
+        std::cout << "    (";
+        for (int rank = 0; rank <= R; ++rank) {
+            std::cout << (rank ? ", " : "") << counts_of_OMs[rank];
+        }
+        std::cout << "): " << nr_OMs << " OMs\n";
+    }
+}
+return 0;
+}
+
+}
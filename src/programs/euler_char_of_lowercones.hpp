@@ -8,6 +8,7 @@
 #include "researchlib.hpp"
 #include "program_template.hpp"
 #include "program_utility.hpp"
+#include "checkpoint_log.hpp"
 
 namespace programs {
 
@@ -115,11 +116,20 @@ private:
 // characteristic of the strict lower cone of each one, and
 // display the results grouped by basecount and euler
 // characteristic.
+//
+// If `checkpoint_path` is not empty, the face vector of every lower
+// cone is recorded in a `CheckpointLog` at that path, and the face
+// vectors already recorded there by an earlier run are not recomputed.
 template<int R, int N>
-int euler_chars_of_all_lowercones_by_bases_using_database() 
+int euler_chars_of_all_lowercones_by_bases_using_database(
+    const std::string& checkpoint_path = ""
+) 
 {
 static_assert((R == 3 && N == 6) || (R == 3 && N == 7),
 "This program must be compiled with parameters (3,6) or (3,7)!");
+CheckpointLog<std::array<size_t, binomial_coefficient(N,R)>> checkpoints(
+    checkpoint_path, checkpoint_tag(EULER_CHAR_OF_LOWERCONES, R, N)
+);
 auto input = ReadOMDataFromFiles<Chirotope<R,N>>(
     &database_names::OM_set<R,N>,
     6
@@ -132,16 +142,22 @@ EulerCharAnalyzer ec_analyzer;
 int current_basecount = 1;
 for (auto p: input) {
     // Parse new OM:
-    auto weak_images = smaller_OMs(
-        all_OMs,
-        base_counts,
-        p.second,
-        p.first
-    );
-    auto fvector = face_vector<binomial_coefficient(N,R)>(
-        lower_cone_face_vectors,
-        weak_images
-    );
+    std::array<size_t, binomial_coefficient(N,R)> fvector;
+    if (checkpoints.is_done(all_OMs.size())) {
+        fvector = checkpoints.result(all_OMs.size());
+    } else {
+        auto weak_images = smaller_OMs(
+            all_OMs,
+            base_counts,
+            p.second,
+            p.first
+        );
+        fvector = face_vector<binomial_coefficient(N,R)>(
+            lower_cone_face_vectors,
+            weak_images
+        );
+        checkpoints.record(all_OMs.size(), fvector);
+    }
     // Print message:
     if (p.first > current_basecount) {
         std::cout << "[" << current_basecount << "] Finished parsing OMs with " 
@@ -154,6 +170,7 @@ for (auto p: input) {
     ec_analyzer.add_entry(ec);
     // Save results:
     all_OMs.push_back(p.second);
+    base_counts.push_back(p.first);
     lower_cone_face_vectors.push_back(fvector);
 }
 std::cout << "[" << current_basecount << "] Finished parsing OMs with " 
@@ -166,4 +183,35 @@ return 0;
 
 
 
+// Same as `euler_chars_of_all_lowercones_by_bases_using_database`,
+// but the Euler characteristics are obtained from the Mobius function
+// of the weak map poset, summed up while the OMs are compared level by
+// level, instead of from the face vectors of the lower cones. Only the
+// Mobius function is kept, not the comparabilities.
+template<int R, int N>
+int euler_chars_of_all_lowercones_by_bases_using_mobius() 
+{
+static_assert((R == 3 && N == 6) || (R == 3 && N == 7),
+"This program must be compiled with parameters (3,6) or (3,7)!");
+OMPoset<R, N> poset(research::read_OMs<R, N>(verboseness::result));
+std::cout << "Computed the Mobius function on all comparabilities.\n";
+auto mu = poset.mobius_from_bottom();
+EulerCharAnalyzer ec_analyzer;
+for (int b = 1; b <= OMPoset<R, N>::NR; ++b) {
+    if (poset.level_start[b] == poset.level_start[b + 1]) continue;
+    for (size_t idx = poset.level_start[b]; idx < poset.level_start[b + 1]; ++idx) {
+        // The Mobius function gives the reduced Euler characteristic.
+        ec_analyzer.add_entry(mu[idx] + 1);
+    }
+    std::cout << "[" << b << "] Finished parsing OMs with " 
+    << b << " bases. ";
+    ec_analyzer.end_batch();
+}
+return 0;
+}
+
+
+
+
+
 }
\ No newline at end of file
@@ -7,6 +7,8 @@
 #include "ordercomplexes.hpp"
 #include "program_template.hpp"
 #include "euler_char_of_lowercones.hpp"
+#include "program_utility.hpp"
+#include "researchlib.hpp"
 
 namespace programs {
 
@@ -161,4 +163,26 @@ ec_analyzer.end_batch();
 return 0;
 }
 
+// Compute the face vector and Euler characteristic of the (strict)
+// upper cone of a single chirotope. No database is used: the upper
+// cone is generated by `research::generate_upper_cone`, so this works
+// for any rank and number of elements, as long as the upper cone is
+// small enough to be stored.
+template<int R, int N>
+inline int compute_euler_char_of_upper_cone(const Chirotope<R, N>& chi) {
+constexpr int NR = binomial_coefficient(N, R);
+std::cout << "This program generates the upper cone of the rank " << R 
+<< " oriented matroid\n" << chi << "\non " << N << " elements, and computes "
+"the face vector and the Euler characteristic of its order complex.\n\n";
+auto upper_cone = OMPoset<R, N>::with_comparabilities(
+    research::generate_upper_cone(chi, verboseness::result)
+);
+auto fvector = face_vector<NR>(upper_cone.template lower_cone_face_vectors<NR>());
+std::cout << "The face vector of the upper cone is:\n";
+utility::print_comma_separated_iterable_of_ints(fvector);
+std::cout << "\nIts Euler characteristic is " 
+<< euler_characteristic<NR>(fvector) << ".\n";
+return 0;
+}
+
 }
\ No newline at end of file
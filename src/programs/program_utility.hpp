@@ -41,15 +41,20 @@ void print_iterable_of_ints(const Iterable& iter, int spacing=3) {
 // Print an iterable producing integers as a horizontal
 // right-adjusted single row table, with column width of
 // `spacing` many characters - excluding the comma.
+// The table is printed to `output`.
 template<typename Iterable>
-void print_comma_separated_iterable_of_ints(const Iterable& iter, int spacing=3) {
+void print_comma_separated_iterable_of_ints(
+    const Iterable& iter, 
+    int spacing=3, 
+    std::ostream& output=std::cout
+) {
     bool first = true;
     for (auto elem: iter) {
         if (!first) {
-            std::cout << ",";
+            output << ",";
         }
         first = false;
-        std::cout << std::setw(spacing) << int(elem);
+        output << std::setw(spacing) << int(elem);
     }
 }
 
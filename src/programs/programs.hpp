@@ -2,12 +2,24 @@
 
 #include "program_utility.hpp"
 #include "compute_fvector_of_MacP_using_database.hpp"
+#include "compute_fvector_of_MacP_using_orbits.hpp"
 #include "compute_euler_char_of_JRG_mod_3.hpp"
 #include "verify_ischirotope_port.hpp"
 #include "test_lower_cone_generation.hpp"
 #include "compute_fvector_of_lowercone.hpp"
 #include "verify_that_small_chirotopes_are_not_isolated.hpp"
+#include "verify_cocircuits.hpp"
+#include "verify_isolation.hpp"
+#include "verify_automorphism_groups.hpp"
+#include "verify_fvector_of_MacP_using_orbits.hpp"
+#include "verify_covectors.hpp"
 #include "prove_r3n7.hpp"
 #include "prove_conjecture.hpp"
 #include "euler_char_of_lowercones.hpp"
-#include "euler_char_of_uppercones.hpp"
\ No newline at end of file
+#include "euler_char_of_uppercones.hpp"
+#include "cone_statistics_using_database.hpp"
+#include "compute_lefschetz_numbers_using_database.hpp"
+#include "covector_statistics_using_database.hpp"
+#include "build_binary_OM_database.hpp"
+#include "build_binary_fixed_OM_database.hpp"
+#include "build_binary_OM_database_by_extensions.hpp"
@@ -3,9 +3,11 @@
 #include <iostream>
 #include <vector>
 #include <algorithm>
+#include <string>
 #include "OMtools.hpp"
 #include "researchlib.hpp"
 #include "program_template.hpp"
+#include "checkpoint_log.hpp"
 
 namespace programs {
 
@@ -14,40 +16,64 @@ namespace programs {
 // are abstractly solvable and are never isolated. This program checks 
 // if all (simple) oriented matroids with certain parameters are good
 // with respect to some element.
+//
+// The isomorphism class representatives are distributed over
+// `nr_threads` threads, which share the lists of matroids. The report
+// of each representative is collected separately (see `report()`), and
+// the reports are printed in the order of the representatives.
+//
+// If `checkpoint_path` is not empty, the result of every representative
+// is recorded in a `CheckpointLog` at that path, and representatives
+// already recorded there by an earlier run are skipped.
 template<int R, int N>
-int always_weakly_abstractly_reducible() {
+int always_weakly_abstractly_reducible(
+    const std::string& checkpoint_path = "",
+    unsigned nr_threads = parallel::default_number_of_threads()
+) {
 const auto iso_representatives = OMexamples::read_all_Finschi_representatives<R,N>();
 std::cout << "Call an oriented matroid M 'good' with respect to "
 "an element e if all weak insertion problems of the form (?,e,M) "
 "are abstractly solvable and are never isolated. This program checks "
 "if all (simple) oriented matroids with certain parameters are good "
 "with respect to some element.\n\n";
-auto matroids = research::matroids_with_few_loops<R, N>(
+const auto matroids = research::matroids_with_few_loops<R, N>(
     N - research::minimum_N_for_not_abstractly_solvable<R>
 );
-auto matroids_to_filter_deletion_with = research::matroids_with_few_loops<R, N>(
+const auto matroids_to_filter_deletion_with = research::matroids_with_few_loops<R, N>(
     N + 1 - research::minimum_N_for_not_abstractly_solvable<R>
 );
 std::cout << "We iterate over all " << iso_representatives.size() 
 << " isomorphism classes of simple oriented matroids "
 "of rank " << R << " and number of elements " << N << ".\n\n";
-int idx_of_current_target = 0;
-std::vector<int> good_wrt_element;
-for (Chirotope<R,N> chi: iso_representatives) {
+CheckpointLog<int> checkpoints(checkpoint_path, checkpoint_tag(PROVE_CONJECTURE, R, N));
+if (checkpoints.number_of_results() > 0) {
+    std::cout << "Resuming from " << checkpoint_path << ", where "
+    << checkpoints.number_of_results() << " targets are already done.\n\n";
+}
+std::vector<int> good_wrt_element(iso_representatives.size());
+parallel::for_each_index_with_ordered_output(0, iso_representatives.size(), 
+[&](size_t idx_of_current_target, std::ostream& log) {
+    RedirectReports redirect(log);
+    const Chirotope<R,N>& chi = iso_representatives[idx_of_current_target];
     // Start announcement
-    std::cout << "[TARGET " << idx_of_current_target << "/"
+    log << "[TARGET " << idx_of_current_target << "/"
     << iso_representatives.size() << "] " << chi << "\n";
+    if (checkpoints.is_done(idx_of_current_target)) {
+        good_wrt_element[idx_of_current_target] = checkpoints.result(idx_of_current_target);
+        log << "Already done in an earlier run.\n\n";
+        return;
+    }
     
-    good_wrt_element.push_back(research::weakly_reducible_by(
+    good_wrt_element[idx_of_current_target] = research::weakly_reducible_by(
         chi,
         matroids,
         matroids_to_filter_deletion_with,
         verboseness::info
-    ));
-    std::cout << "\n";
-    // Iterate
-    idx_of_current_target++;
-}
+    );
+    checkpoints.record(idx_of_current_target, good_wrt_element[idx_of_current_target]);
+    log << "\n";
+}, std::cout, nr_threads);
+checkpoints.sync();
 
 bool was_anything_not_reducible = false;
 std::cout << "Result compilation:\n";
@@ -3,9 +3,11 @@
 #include <iostream>
 #include <vector>
 #include <algorithm>
+#include <string>
 #include "OMtools.hpp"
 #include "researchlib.hpp"
 #include "program_template.hpp"
+#include "checkpoint_log.hpp"
 
 namespace programs {
 
@@ -15,27 +17,39 @@ namespace programs {
 // non-isolated, and for which all weak insertion problems
 // (where the smaller OM has no unnecessary loops) are
 // abstractly solvable.
-inline int prove_r3n7() {
+//
+// If `checkpoint_path` is not empty, the result of every target is
+// recorded in a `CheckpointLog` at that path, and targets already
+// recorded there by an earlier run are skipped.
+inline int prove_r3n7(const std::string& checkpoint_path = "") {
 const auto r3n7_representatives = OMexamples::read_all_Finschi_representatives<3,7>();
 std::cout << "Proving the conjecture for (3,7).\n"
 "We iterate over all " << r3n7_representatives.size() 
 << " isomorphism classes of simple oriented matroids "
 "of rank 3 and number of elements 7.\n\n";
+CheckpointLog<int> checkpoints(checkpoint_path, checkpoint_tag(PROVE_R3N7, 3, 7));
 int idx_of_current_target = 0;
 std::vector<int> weakly_reducible_by_element;
 for (Chirotope<3,7> chi: r3n7_representatives) {
     // Start announcement
     std::cout << "[TARGET " << idx_of_current_target << "/"
     << r3n7_representatives.size() << "] " << chi << "\n";
+    if (checkpoints.is_done(idx_of_current_target)) {
+        weakly_reducible_by_element.push_back(checkpoints.result(idx_of_current_target));
+        std::cout << "Already done in an earlier run.\n\n";
+        idx_of_current_target++;
+        continue;
+    }
     // Quick setup
     auto cocircuits = OM_operations::cocircuits(chi);
+    research::ConstrainsTable<3,7> constrains_table(chi, cocircuits);
     // Slow setup
     std::cout << "Computing lower cone of target...\n";
     auto lower_cone_filtered = research::lower_cone_with_few_loops<3,7>(chi, 0, verboseness::result);
     // Check each element if chi can be weakly reduced by it
     weakly_reducible_by_element.push_back(-1);
     for (int e = 0; e < 7; ++e) {
-        if (research::is_isolated(chi,cocircuits,e)) {
+        if (research::is_isolated(chi,cocircuits,constrains_table,e)) {
             std::cout << "- element " << e << " is isolated\n";
             continue;
         }
@@ -123,9 +137,11 @@ for (Chirotope<3,7> chi: r3n7_representatives) {
         std::cout << "[FAILURE] the chirotope " << chi << " is not weakly "
         "reducible by any element\n\n";
     }
+    checkpoints.record(idx_of_current_target, weakly_reducible_by_element.back());
     // Iterate
     idx_of_current_target++;
 }
+checkpoints.sync();
 
 bool was_anything_not_reducible = false;
 std::cout << "Result compilation:\n";
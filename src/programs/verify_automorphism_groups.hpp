@@ -0,0 +1,91 @@
+#pragma once
+
+#include <algorithm>
+#include <iostream>
+#include <numeric>
+#include <string>
+#include <vector>
+#include "OMtools.hpp"
+#include "researchlib.hpp"
+#include "program_template.hpp"
+
+namespace programs {
+
+// This is a test to check `OM_operations::automorphism_group` and
+// `OM_operations::orbit_size` against brute force. For RS8, EFM8,
+// RIN9, PAPPUS, NON_PAPPUS and the Finschi representatives of all
+// oriented matroids of parameters (3,7) and (4,7), the order of the
+// automorphism group (with and without reorientations) is compared
+// with the number of the `N!` relabelings which give the same oriented
+// matroid (up to reorientation). Next, for the Finschi representatives,
+// `orbit_size` is compared with the size of the enumerated `orbit`.
+inline int verify_automorphism_groups()
+{
+// Returns whether the orders of both automorphism groups of `chi`
+// agree with the brute force counts.
+auto automorphisms_agree = []<int R, int N>(const Chirotope<R, N>& chi, const std::string& name) {
+    const auto reoriented = OM_operations::canonical_reorientation(chi);
+    const auto reoriented_inverse = OM_operations::canonical_reorientation(chi.inverse());
+    uint64_t nr_automorphisms = 0;
+    uint64_t nr_automorphisms_up_to_reorientation = 0;
+    std::vector<int> permutation(N);
+    std::iota(permutation.begin(), permutation.end(), 0);
+    do {
+        auto relabeled = OM_operations::relabel_elements<R, N>(permutation)(chi);
+        if (relabeled.is_same_OM_as(chi)) ++nr_automorphisms;
+        auto relabeled_reoriented = OM_operations::canonical_reorientation(relabeled);
+        if (relabeled_reoriented == reoriented || relabeled_reoriented == reoriented_inverse)
+            ++nr_automorphisms_up_to_reorientation;
+    } while (std::next_permutation(permutation.begin(), permutation.end()));
+    const uint64_t order = OM_operations::automorphism_group(chi).order();
+    const uint64_t order_up_to_reorientation = OM_operations::automorphism_group(chi, true).order();
+    if (order == nr_automorphisms && order_up_to_reorientation == nr_automorphisms_up_to_reorientation)
+        return true;
+    std::cout << "(;_;) The automorphism groups of " << name << " have orders "
+    << order << " and " << order_up_to_reorientation << " (with reorientations), "
+    "but brute force finds " << nr_automorphisms << " and "
+    << nr_automorphisms_up_to_reorientation << ":\n" << chi << "\n";
+    return false;
+};
+// Returns whether `orbit_size` agrees with the size of the orbit of
+// every chirotope in `chis`.
+auto orbit_sizes_agree = []<int R, int N>(const std::vector<Chirotope<R, N>>& chis) {
+    for (const auto& chi: chis) {
+        const uint64_t size = OM_operations::orbit_size(chi);
+        const uint64_t nr_enumerated = OM_operations::orbit(chi).size();
+        if (size == nr_enumerated) continue;
+        std::cout << "(;_;) orbit_size gives " << size << ", but the orbit "
+        "has " << nr_enumerated << " chirotopes:\n" << chi << "\n";
+        return false;
+    }
+    std::cout << "Checked the orbit sizes of all " << chis.size()
+    << " Finschi representatives of parameters (" << R << ", " << N << ").\n";
+    return true;
+};
+
+if (!automorphisms_agree(OMexamples::RS8, "RS8")) return 1;
+if (!automorphisms_agree(OMexamples::EFM8, "EFM8")) return 1;
+if (!automorphisms_agree(OMexamples::RIN9, "RIN9")) return 1;
+if (!automorphisms_agree(OMexamples::PAPPUS, "PAPPUS")) return 1;
+if (!automorphisms_agree(OMexamples::NON_PAPPUS, "NON_PAPPUS")) return 1;
+std::cout << "Checked the automorphism groups of the examples.\n";
+const auto r3n7_representatives = OMexamples::read_all_Finschi_representatives<3, 7>();
+const auto r4n7_representatives = OMexamples::read_all_Finschi_representatives<4, 7>();
+for (size_t i = 0; i < r3n7_representatives.size(); ++i) {
+    if (!automorphisms_agree(r3n7_representatives[i], "representative " + std::to_string(i)))
+        return 1;
+}
+for (size_t i = 0; i < r4n7_representatives.size(); ++i) {
+    if (!automorphisms_agree(r4n7_representatives[i], "representative " + std::to_string(i)))
+        return 1;
+}
+std::cout << "Checked the automorphism groups of the Finschi representatives.\n";
+if (!orbit_sizes_agree(r3n7_representatives)) return 1;
+if (!orbit_sizes_agree(r4n7_representatives)) return 1;
+std::cout << "(OuO) Success!! All automorphism groups and orbit sizes agree "
+"with brute force.\n";
+return 0;
+
+}
+
+}
@@ -0,0 +1,114 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <utility>
+#include <vector>
+#include "OMtools.hpp"
+#include "researchlib.hpp"
+#include "program_utility.hpp"
+#include "program_template.hpp"
+
+namespace programs {
+
+// Using a precomputed database of all oriented matroids of a given
+// rank and number of elements, checks that `OM_operations::cocircuits`
+// gathering the cocircuits at once agrees with the extraction one by
+// one of `OM_operations::cocircuits_by_extractors` (which it uses for
+// `N > 32`) on every oriented matroid: both lists must have the same
+// cocircuits in the same order with the same signs. The oriented
+// matroids are distributed over `nr_threads` threads.
+//
+// Next, checks for every oriented matroid and every set of elements
+// that the cocircuits of its deletion held by `research::DeletionCache`,
+// which are derived with `OM_operations::cocircuits_of_deletion`, are
+// the cocircuits of the deletion by `OM_operations::delete_elements`
+// up to order and signs. This includes the deletions of lower rank,
+// which have no cocircuits at all.
+template<int R, int N>
+int verify_cocircuits(
+    unsigned nr_threads = parallel::default_number_of_threads()
+)
+{
+static_assert((R == 3 && N == 6) || (R == 3 && N == 7),
+"This program must be compiled with parameters (3,6) or (3,7)!");
+const auto OMs_by_basecount = research::read_OMs<R, N>(verboseness::result);
+size_t count = 0;
+for (const auto& OMs: OMs_by_basecount) {
+    std::vector<char> agrees(OMs.size());
+    parallel::for_each_index(0, OMs.size(), [&](size_t idx) {
+        agrees[idx] = OM_operations::cocircuits(OMs[idx])
+            == OM_operations::cocircuits_by_extractors(OMs[idx]);
+    }, nr_threads, 64);
+    for (size_t idx = 0; idx < OMs.size(); ++idx) {
+        if (agrees[idx]) continue;
+        std::cout << "(;_;) The two ways of computing the cocircuits "
+        "disagree on the oriented matroid\n\n";
+        utility::print_Rtuples<R, N>();
+        std::cout << "\n" << OMs[idx] << "\n\nGathered at once:\n\n";
+        for (auto cocircuit: OM_operations::cocircuits(OMs[idx]))
+            std::cout << cocircuit << "\n";
+        std::cout << "\nExtracted one by one:\n\n";
+        for (auto cocircuit: OM_operations::cocircuits_by_extractors(OMs[idx]))
+            std::cout << cocircuit << "\n";
+        return 1;
+    }
+    count += OMs.size();
+}
+std::cout << "(OuO) Success!! Both ways of computing the cocircuits "
+"agree on all " << count << " oriented matroids of parameters ("
+<< R << ", " << N << ").\n";
+
+// The cocircuits, each reoriented to be `+` on its first nonzero
+// element, as sorted pairs of masks.
+auto up_to_sign = [](const std::vector<sign_vector<N>>& cocircuits) {
+    std::vector<std::pair<uint32_t, uint32_t>> normalized;
+    for (const auto& cocircuit: cocircuits) {
+        uint32_t plus = cocircuit.plus[0];
+        uint32_t minus = cocircuit.minus[0];
+        uint32_t first = (plus | minus) & -(plus | minus);
+        if (minus & first) std::swap(plus, minus);
+        normalized.emplace_back(plus, minus);
+    }
+    std::sort(normalized.begin(), normalized.end());
+    return normalized;
+};
+constexpr uint32_t NR_SETS = uint32_t(1) << N;
+size_t nr_lower_rank = 0;
+for (const auto& OMs: OMs_by_basecount) {
+    // The first set of elements on which the two disagree, if any.
+    std::vector<uint32_t> disagreeing(OMs.size(), NR_SETS);
+    std::vector<size_t> nr_lower_rank_of_OM(OMs.size(), 0);
+    parallel::for_each_index(0, OMs.size(), [&](size_t idx) {
+        research::DeletionCache<R, N> cache(OMs[idx]);
+        for (uint32_t deleted = 0; deleted < NR_SETS; ++deleted) {
+            std::vector<int> elements;
+            for (int e = 0; e < N; ++e) if ((deleted >> e) & 1) elements.push_back(e);
+            auto deletion = OM_operations::delete_elements<R, N>(elements)(OMs[idx]);
+            const auto& cached = cache.deletion(deleted).cocircuits;
+            if (cached.empty()) ++nr_lower_rank_of_OM[idx];
+            if (up_to_sign(cached) != up_to_sign(OM_operations::cocircuits(deletion))) {
+                disagreeing[idx] = deleted;
+                return;
+            }
+        }
+    }, nr_threads, 64);
+    for (size_t idx = 0; idx < OMs.size(); ++idx) {
+        nr_lower_rank += nr_lower_rank_of_OM[idx];
+        if (disagreeing[idx] == NR_SETS) continue;
+        std::cout << "(;_;) The cocircuits of the deletion of the set of "
+        "elements with mask " << disagreeing[idx] << " disagree for the "
+        "oriented matroid\n\n";
+        utility::print_Rtuples<R, N>();
+        std::cout << "\n" << OMs[idx] << "\n";
+        return 1;
+    }
+}
+std::cout << "(OuO) Success!! The cocircuits of all " << count * NR_SETS
+<< " deletions agree, " << nr_lower_rank << " of which have lower rank.\n";
+return 0;
+
+}
+
+}
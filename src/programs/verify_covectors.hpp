@@ -0,0 +1,120 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <iostream>
+#include <set>
+#include <utility>
+#include <vector>
+#include "OMtools.hpp"
+#include "researchlib.hpp"
+#include "program_utility.hpp"
+#include "program_template.hpp"
+
+namespace programs {
+
+// This is a test to check `OM_operations::covectors_by_rank` and the
+// tope enumeration. For every `sample_step`th oriented matroid of the
+// database of parameters (3,7), the covectors are computed by brute
+// force as the closure of the zero vector and the cocircuits (of both
+// signs) under composition, and compared rank by rank with
+// `covectors_by_rank`, and their topes with `topes`. Next, for the
+// uniform Finschi representatives of parameters (3,7), (3,8) and
+// (4,7), and for RS8, EFM8 and RIN9, the number of topes found by
+// `for_each_tope` and `number_of_topes` is compared with Zaslavsky's
+// formula `2 * (binomial(N-1,0) + ... + binomial(N-1,R-1))` for the
+// uniform matroid of rank `R` on `N` elements.
+inline int verify_covectors(size_t sample_step = 97)
+{
+constexpr int R0 = 3;
+constexpr int N0 = 7;
+// The sign vectors as pairs of their words of `plus` and `minus`.
+using Masks = std::pair<uint32_t, uint32_t>;
+auto to_masks = [](const sign_vector<N0>& v) { return Masks(v.plus[0], v.minus[0]); };
+const auto OMs_by_basecount = research::read_OMs<R0, N0>(verboseness::result);
+size_t count = 0;
+size_t nr_sampled = 0;
+for (const auto& OMs: OMs_by_basecount) {
+    for (const auto& chi: OMs) {
+        if (count++ % sample_step != 0) continue;
+        ++nr_sampled;
+        std::vector<Masks> closure{Masks(0, 0)};
+        for (const auto& cocircuit: OM_operations::cocircuits(chi)) {
+            closure.push_back(to_masks(cocircuit));
+            closure.emplace_back(cocircuit.minus[0], cocircuit.plus[0]);
+        }
+        std::set<Masks> found(closure.begin(), closure.end());
+        for (size_t i = 0; i < closure.size(); ++i) {
+            for (size_t j = 0; j <= i; ++j) {
+                for (auto [X, Y]: {std::pair(closure[i], closure[j]), std::pair(closure[j], closure[i])}) {
+                    const uint32_t support = X.first | X.second;
+                    Masks composition(X.first | (Y.first & ~support), X.second | (Y.second & ~support));
+                    if (found.insert(composition).second) closure.push_back(composition);
+                }
+            }
+        }
+        // The brute force covectors by rank, and those of `covectors_by_rank`.
+        std::vector<std::vector<Masks>> expected(R0 + 1);
+        for (const auto& [plus, minus]: found) {
+            sign_vector<N0> covector{};
+            covector.plus[0] = plus;
+            covector.minus[0] = minus;
+            expected[R0 - chi.rank(covector.indices_of_zeros())].emplace_back(plus, minus);
+        }
+        auto covectors = OM_operations::covectors_by_rank(chi, 1);
+        std::vector<Masks> topes;
+        for (const auto& tope: OM_operations::topes(chi, 1)) topes.push_back(to_masks(tope));
+        std::sort(topes.begin(), topes.end());
+        bool agrees = covectors.size() == R0 + 1 && topes == expected[R0];
+        for (int k = 0; k <= R0 && agrees; ++k) {
+            std::vector<Masks> computed;
+            for (const auto& covector: covectors[k]) computed.push_back(to_masks(covector));
+            std::sort(computed.begin(), computed.end());
+            agrees = computed == expected[k];
+        }
+        if (agrees) continue;
+        std::cout << "(;_;) The covectors disagree with the composition "
+        "closure of the cocircuits of the oriented matroid\n\n";
+        utility::print_Rtuples<R0, N0>();
+        std::cout << "\n" << chi << "\n";
+        return 1;
+    }
+}
+std::cout << "Checked the covectors of " << nr_sampled << "/" << count
+<< " oriented matroids of parameters (" << R0 << ", " << N0 << ").\n";
+
+// Returns whether both tope counts of the uniform chirotope `chi`
+// agree with Zaslavsky's formula.
+auto tope_counts_agree = []<int R, int N>(const Chirotope<R, N>& chi) {
+    size_t expected = 0;
+    for (int i = 0; i < R; ++i) expected += binomial_coefficient(N - 1, i);
+    expected *= 2;
+    std::atomic<size_t> nr_enumerated = 0;
+    OM_operations::for_each_tope(chi, [&](unsigned, const sign_vector<N>&) {
+        ++nr_enumerated;
+    });
+    const size_t nr_counted = OM_operations::number_of_topes(chi);
+    if (nr_enumerated == expected && nr_counted == expected) return true;
+    std::cout << "(;_;) The uniform oriented matroid\n" << chi << "\nhas "
+    << nr_enumerated << " topes by for_each_tope and " << nr_counted
+    << " by number_of_topes, but should have " << expected << ".\n";
+    return false;
+};
+for (const auto& chi: OMexamples::read_uniform_Finschi_representatives<3, 7>())
+    if (!tope_counts_agree(chi)) return 1;
+for (const auto& chi: OMexamples::read_uniform_Finschi_representatives<3, 8>())
+    if (!tope_counts_agree(chi)) return 1;
+for (const auto& chi: OMexamples::read_uniform_Finschi_representatives<4, 7>())
+    if (!tope_counts_agree(chi)) return 1;
+if (!tope_counts_agree(OMexamples::RS8)) return 1;
+if (!tope_counts_agree(OMexamples::EFM8)) return 1;
+if (!tope_counts_agree(OMexamples::RIN9)) return 1;
+std::cout << "(OuO) Success!! The covectors agree with the composition "
+"closures, and the tope counts of the uniform oriented matroids with "
+"Zaslavsky's formula.\n";
+return 0;
+
+}
+
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <iostream>
+#include <vector>
+#include <array>
+#include "OMtools.hpp"
+#include "researchlib.hpp"
+#include "program_template.hpp"
+
+namespace programs {
+
+// This is a test to check that `compute_fvector_of_MacP_using_orbits`
+// agrees with `compute_fvector_of_MacP_using_database`. The f-vector
+// of `MacP(R,N)` is computed once from Finschi's uniform
+// representatives with an `OrbitPoset`, and once from the database of
+// all oriented matroids with an `OMPoset`. For each basecount, the
+// number of oriented matroids and the number of them whose lower cone
+// has an Euler characteristic other than `1` are compared, and then
+// the total f-vectors.
+template<int R, int N>
+int verify_fvector_of_MacP_using_orbits()
+{
+static_assert((R == 3 && N == 6) || (R == 3 && N == 7),
+"This program must be compiled with parameters (3,6) or (3,7)!");
+constexpr int NR = binomial_coefficient(N, R);
+auto uniform_representatives = OMexamples::read_uniform_Finschi_representatives<R, N>();
+if (uniform_representatives.empty()) {
+    std::cout << "Could not read any uniform representatives from "
+    << database_names::uniform_Finschi<R, N> << ".\n";
+    return 1;
+}
+OrbitPoset<R, N> orbit_poset(uniform_representatives);
+auto orbit_lower_fvs = orbit_poset.template lower_cone_face_vectors<NR>();
+std::cout << "Computed the lower cones of " << orbit_poset.size()
+<< " isomorphism classes.\n";
+OMPoset<R, N> poset(research::read_OMs<R, N>(verboseness::result));
+auto lower_fvs = poset.template lower_cone_face_vectors<NR>();
+std::cout << "Computed the lower cones of all " << poset.size() << " OMs.\n";
+
+for (int b = 1; b <= NR; ++b) {
+    uint64_t orbit_OMs = 0, orbit_OMs_with_non_1_ec = 0;
+    for (auto idx = orbit_poset.level_start[b]; idx < orbit_poset.level_start[b + 1]; ++idx) {
+        orbit_OMs += orbit_poset.orbit_sizes[idx];
+        if (euler_characteristic<NR>(orbit_lower_fvs[idx]) != 1)
+            orbit_OMs_with_non_1_ec += orbit_poset.orbit_sizes[idx];
+    }
+    uint64_t OMs = poset.level_start[b + 1] - poset.level_start[b];
+    uint64_t OMs_with_non_1_ec = 0;
+    for (auto idx = poset.level_start[b]; idx < poset.level_start[b + 1]; ++idx) {
+        if (euler_characteristic<NR>(lower_fvs[idx]) != 1) ++OMs_with_non_1_ec;
+    }
+    if (orbit_OMs != OMs || orbit_OMs_with_non_1_ec != OMs_with_non_1_ec) {
+        std::cout << "(;_;) For OMs with " << b << " bases, the orbits give "
+        << orbit_OMs_with_non_1_ec << "/" << orbit_OMs << " and the database gives "
+        << OMs_with_non_1_ec << "/" << OMs << " many of them with non-1 "
+        "Euler-characteristic.\n";
+        return 1;
+    }
+}
+
+auto orbit_f = orbit_poset.template face_vector<NR>(orbit_lower_fvs);
+auto f = face_vector<NR>(lower_fvs);
+if (orbit_f != f) {
+    std::cout << "(;_;) The f-vectors disagree:\n";
+    for (auto d = 0; d < NR; d++) {
+        std::cout << d << ": " << orbit_f[d] << " from the orbits, "
+        << f[d] << " from the database\n";
+    }
+    return 1;
+}
+std::cout << "(OuO) Success!! Both ways give the f-vector (" << f[0];
+for (auto d = 1; d < NR; d++) {
+    std::cout << ", " << f[d];
+}
+std::cout << ") of MacP(" << R << ", " << N << ").\n";
+return 0;
+}
+
+}
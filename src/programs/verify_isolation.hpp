@@ -0,0 +1,98 @@
+#pragma once
+
+#include <array>
+#include <iostream>
+#include <span>
+#include <vector>
+#include "OMtools.hpp"
+#include "researchlib.hpp"
+#include "program_utility.hpp"
+#include "program_template.hpp"
+
+namespace programs {
+
+// Using a precomputed database of all oriented matroids of a given
+// rank and number of elements, checks for every element of every
+// oriented matroid that `research::is_isolated`, which searches the
+// packed masks of the constraining cocircuits, agrees with a plain
+// search: for every `R`-subset of the cocircuits which constrain the
+// element (see `research::constrains`), oriented so that they are not
+// `-` on it, and every way of reversing those of them which are `0` on
+// it, test with `research::exists_covariant_nonloop` whether they
+// isolate the element. The oriented matroids are distributed over
+// `nr_threads` threads.
+template<int R, int N>
+int verify_isolation(
+    unsigned nr_threads = parallel::default_number_of_threads()
+)
+{
+static_assert((R == 3 && N == 6) || (R == 3 && N == 7),
+"This program must be compiled with parameters (3,6) or (3,7)!");
+auto is_isolated_by_search = [](
+    const Chirotope<R, N>& chi, std::vector<sign_vector<N>> cocircuits, char element
+) {
+    std::vector<int> constraining{};
+    for (int j = 0; j < cocircuits.size(); ++j) {
+        if (research::constrains(chi, cocircuits[j], element)) {
+            if (cocircuits[j].minus.get_bit(element)) cocircuits[j].invert();
+            constraining.push_back(j);
+        }
+    }
+    for (std::array<char, R> Rtuple: Rtuples::iterator<char, R>(constraining.size())) {
+        // Bit `t` of `reversed` reverses the `t`th chosen cocircuit.
+        for (int reversed = 0; reversed < (1 << R); ++reversed) {
+            std::array<sign_vector<N>, R> chosen;
+            std::array<const sign_vector<N>*, R> chosen_ptrs;
+            bool is_valid = true;
+            for (int t = 0; t < R; ++t) {
+                chosen[t] = cocircuits[constraining[Rtuple[t]]];
+                if ((reversed >> t) & 1) {
+                    is_valid &= !chosen[t].plus.get_bit(element);
+                    chosen[t].invert();
+                }
+                chosen_ptrs[t] = &chosen[t];
+            }
+            if (is_valid && !research::exists_covariant_nonloop<R, N>(
+                chi, std::span<const sign_vector<N>*, R>(chosen_ptrs), element
+            )) return true;
+        }
+    }
+    return false;
+};
+const auto OMs_by_basecount = research::read_OMs<R, N>(verboseness::result);
+size_t count = 0;
+size_t nr_isolated = 0;
+for (const auto& OMs: OMs_by_basecount) {
+    // Bit `e` is set if the two disagree on the element `e`.
+    std::vector<uint32_t> disagreeing(OMs.size(), 0);
+    std::vector<size_t> nr_isolated_of_OM(OMs.size(), 0);
+    parallel::for_each_index(0, OMs.size(), [&](size_t idx) {
+        auto cocircuits = OM_operations::cocircuits(OMs[idx]);
+        research::ConstrainsTable<R, N> constrains_table(OMs[idx], cocircuits);
+        for (int e = 0; e < N; ++e) {
+            bool expected = is_isolated_by_search(OMs[idx], cocircuits, e);
+            if (expected) ++nr_isolated_of_OM[idx];
+            if (research::is_isolated<R, N>(OMs[idx], cocircuits, constrains_table, e) != expected)
+                disagreeing[idx] |= uint32_t(1) << e;
+        }
+    }, nr_threads, 64);
+    for (size_t idx = 0; idx < OMs.size(); ++idx) {
+        nr_isolated += nr_isolated_of_OM[idx];
+        if (disagreeing[idx] == 0) continue;
+        std::cout << "(;_;) The two searches disagree on whether the elements "
+        "with mask " << disagreeing[idx] << " are isolated in the oriented "
+        "matroid\n\n";
+        utility::print_Rtuples<R, N>();
+        std::cout << "\n" << OMs[idx] << "\n";
+        return 1;
+    }
+    count += OMs.size();
+}
+std::cout << "(OuO) Success!! Both searches agree on all elements of all "
+<< count << " oriented matroids of parameters (" << R << ", " << N << "), "
+<< nr_isolated << " of which are isolated.\n";
+return 0;
+
+}
+
+}
@@ -27,10 +27,11 @@ int last_basecount = 0;
 for (auto p: input) {
     // PARSE
     all_OMs_by_bases[p.first - 1].push_back(p.second);
+    auto cocircuits = OM_operations::cocircuits(p.second);
+    research::ConstrainsTable<R,N> constrains_table(p.second,cocircuits);
     for (auto e = 0; e < N; ++e) {
-        auto cocircuits = OM_operations::cocircuits(p.second);
         if (!p.second.is_loop(e) &&
-        research::is_isolated<R,N>(p.second,cocircuits,e)) {
+        research::is_isolated<R,N>(p.second,cocircuits,constrains_table,e)) {
             std::cout << "The element " << e << " was found "
             "to be isolated in the oriented matroid\n\n";
             utility::print_Rtuples<R,N>();